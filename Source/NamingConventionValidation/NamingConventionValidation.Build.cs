@@ -1,37 +1,44 @@
-namespace UnrealBuildTool.Rules
-{
-    public class NamingConventionValidation : ModuleRules
-    {
-        public NamingConventionValidation( ReadOnlyTargetRules Target )
-            : base( Target )
-        {
-            PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
-            bEnforceIWYU = true;
-            
-            PrivateIncludePaths.Add("NamingConventionValidation/Private");
-
-            PublicDependencyModuleNames.AddRange(
-                new string[] { 
-                    "Core",
-                    "CoreUObject",
-                    "Engine",
-                    "TargetPlatform",
-                    "AssetRegistry",
-                    "EditorSubsystem",
-                    "DeveloperSettings"
-                }
-            );
-
-            PrivateDependencyModuleNames.AddRange(
-                new string[] {
-                    "Slate",
-                    "SlateCore",
-                    "UnrealEd",
-                    "AssetRegistry",
-                    "EditorStyle",
-                    "Blutility"
-                }
-            );
-        }
-    }
-}
+namespace UnrealBuildTool.Rules
+{
+    public class NamingConventionValidation : ModuleRules
+    {
+        public NamingConventionValidation( ReadOnlyTargetRules Target )
+            : base( Target )
+        {
+            PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+            bEnforceIWYU = true;
+            
+            PrivateIncludePaths.Add("NamingConventionValidation/Private");
+
+            PublicDependencyModuleNames.AddRange(
+                new string[] { 
+                    "Core",
+                    "CoreUObject",
+                    "Engine",
+                    "TargetPlatform",
+                    "AssetRegistry",
+                    "EditorSubsystem",
+                    "DeveloperSettings",
+                    "DataValidation"
+                }
+            );
+
+            PrivateDependencyModuleNames.AddRange(
+                new string[] {
+                    "Slate",
+                    "SlateCore",
+                    "UnrealEd",
+                    "AssetRegistry",
+                    "EditorStyle",
+                    "Blutility",
+                    "ContentBrowser",
+                    "ContentBrowserData",
+                    "Sockets",
+                    "Networking",
+                    "DirectoryWatcher",
+                    "Projects"
+                }
+            );
+        }
+    }
+}
@@ -1,469 +1,1743 @@
-#include "EditorNamingValidatorSubsystem.h"
-
-#include "NamingConventionValidationSettings.h"
-#include "NamingConventionValidationLog.h"
-
-#include <AssetRegistryModule.h>
-#include <Editor.h>
-#include <EditorNamingValidatorBase.h>
-#include <EditorUtilityBlueprint.h>
-#include <Logging/MessageLog.h>
-#include <MessageLog/Public/MessageLogInitializationOptions.h>
-#include <MessageLog/Public/MessageLogModule.h>
-#include <Misc/ScopedSlowTask.h>
-#include <UObject/UObjectHash.h>
-
-#define LOCTEXT_NAMESPACE "NamingConventionValidationManager"
-
-bool TryGetAssetDataRealClass( FName & asset_class, const FAssetData & asset_data )
-{
-    static const FName
-        NativeParentClassKey( "NativeParentClass" ),
-        NativeClassKey( "NativeClass" );
-
-    if ( !asset_data.GetTagValue( NativeParentClassKey, asset_class ) )
-    {
-        if ( !asset_data.GetTagValue( NativeClassKey, asset_class ) )
-        {
-            if ( auto * asset = asset_data.GetAsset() )
-            {
-                const FSoftClassPath class_path( asset->GetClass() );
-                asset_class = *class_path.ToString();
-            }
-            else
-            {
-                return false;
-            }
-        }
-    }
-
-    return true;
-}
-
-UEditorNamingValidatorSubsystem::UEditorNamingValidatorSubsystem()
-{
-    AllowBlueprintValidators = true;
-}
-
-void UEditorNamingValidatorSubsystem::Initialize( FSubsystemCollectionBase & /*collection*/ )
-{
-    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
-
-    if ( !asset_registry_module.Get().IsLoadingAssets() )
-    {
-        RegisterBlueprintValidators();
-    }
-    else
-    {
-        if ( !asset_registry_module.Get().OnFilesLoaded().IsBoundToObject( this ) )
-        {
-            asset_registry_module.Get().OnFilesLoaded().AddUObject( this, &UEditorNamingValidatorSubsystem::RegisterBlueprintValidators );
-        }
-    }
-
-    TArray< UClass * > validator_classes;
-    GetDerivedClasses( UEditorNamingValidatorBase::StaticClass(), validator_classes );
-    for ( auto * validator_class : validator_classes )
-    {
-        if ( !validator_class->HasAllClassFlags( CLASS_Abstract ) )
-        {
-            if ( const auto * class_package = validator_class->GetOuterUPackage() )
-            {
-                const auto module_name = FPackageName::GetShortFName( class_package->GetFName() );
-                if ( FModuleManager::Get().IsModuleLoaded( module_name ) )
-                {
-                    auto * validator = NewObject< UEditorNamingValidatorBase >( GetTransientPackage(), validator_class );
-                    AddValidator( validator );
-                }
-            }
-        }
-    }
-
-    FMessageLogInitializationOptions init_options;
-    init_options.bShowFilters = true;
-
-    auto * settings = GetMutableDefault< UNamingConventionValidationSettings >();
-
-    auto & message_log_module = FModuleManager::LoadModuleChecked< FMessageLogModule >( "MessageLog" );
-    message_log_module.RegisterLogListing( "NamingConventionValidation", LOCTEXT( "NamingConventionValidation", "Naming Convention Validation" ), init_options );
-
-    for ( auto & class_description : settings->ClassDescriptions )
-    {
-        class_description.Class = class_description.ClassPath.LoadSynchronous();
-
-        UE_CLOG( class_description.Class == nullptr, LogNamingConventionValidation, Warning, TEXT( "Impossible to get a valid UClass for the classpath %s" ), *class_description.ClassPath.ToString() );
-    }
-
-    settings->ClassDescriptions.Sort();
-
-    for ( auto & class_path : settings->ExcludedClassPaths )
-    {
-        auto * excluded_class = class_path.LoadSynchronous();
-        UE_CLOG( excluded_class == nullptr, LogNamingConventionValidation, Warning, TEXT( "Impossible to get a valid UClass for the excluded classpath %s" ), *class_path.ToString() );
-
-        if ( excluded_class != nullptr )
-        {
-            settings->ExcludedClasses.Add( excluded_class );
-        }
-    }
-
-    static const FDirectoryPath
-        EngineDirectoryPath( { TEXT( "/Engine/" ) } );
-
-    // Cannot use AddUnique since FDirectoryPath does not have operator==
-    if ( !settings->ExcludedDirectories.ContainsByPredicate( []( const auto & item ) {
-             return item.Path == EngineDirectoryPath.Path;
-         } ) )
-    {
-        settings->ExcludedDirectories.Add( EngineDirectoryPath );
-    }
-}
-
-void UEditorNamingValidatorSubsystem::Deinitialize()
-{
-    CleanupValidators();
-
-    Super::Deinitialize();
-}
-
-int32 UEditorNamingValidatorSubsystem::ValidateAssets( const TArray< FAssetData > & asset_data_list, bool /*skip_excluded_directories*/, const bool show_if_no_failures ) const
-{
-    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
-
-    FScopedSlowTask slow_task( 1.0f, LOCTEXT( "NamingConventionValidatingDataTask", "Validating Naming Convention..." ) );
-    slow_task.Visibility = show_if_no_failures ? ESlowTaskVisibility::ForceVisible : ESlowTaskVisibility::Invisible;
-
-    if ( show_if_no_failures )
-    {
-        slow_task.MakeDialogDelayed( 0.1f );
-    }
-
-    FMessageLog data_validation_log( "NamingConventionValidation" );
-
-    auto num_files_checked = 0;
-    auto num_valid_files = 0;
-    auto num_invalid_files = 0;
-    auto num_files_skipped = 0;
-    auto num_files_unable_to_validate = 0;
-
-    const auto num_files_to_validate = asset_data_list.Num();
-
-    for ( const auto & asset_data : asset_data_list )
-    {
-        slow_task.EnterProgressFrame( 1.0f / num_files_to_validate, FText::Format( LOCTEXT( "ValidatingNamingConventionFilename", "Validating Naming Convention {0}" ), FText::FromString( asset_data.GetFullName() ) ) );
-
-        FText error_message;
-        const auto result = IsAssetNamedCorrectly( error_message, asset_data );
-
-        switch ( result )
-        {
-            case ENamingConventionValidationResult::Excluded:
-            {
-                data_validation_log.Info()
-                    ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
-                    ->AddToken( FTextToken::Create( LOCTEXT( "ExcludedNamingConventionResult", "has not been tested based on the configuration." ) ) )
-                    ->AddToken( FTextToken::Create( error_message ) );
-
-                ++num_files_skipped;
-            }
-            break;
-            case ENamingConventionValidationResult::Valid:
-            {
-                ++num_valid_files;
-                ++num_files_checked;
-            }
-            break;
-            case ENamingConventionValidationResult::Invalid:
-            {
-                data_validation_log.Error()
-                    ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
-                    ->AddToken( FTextToken::Create( LOCTEXT( "InvalidNamingConventionResult", "does not match naming convention." ) ) )
-                    ->AddToken( FTextToken::Create( error_message ) );
-
-                ++num_invalid_files;
-                ++num_files_checked;
-            }
-            break;
-            case ENamingConventionValidationResult::Unknown:
-            {
-                if ( show_if_no_failures && settings->LogWarningWhenNoClassDescriptionForAsset )
-                {
-                    FFormatNamedArguments arguments;
-                    arguments.Add( TEXT( "ClassName" ), FText::FromString( asset_data.AssetClass.ToString() ) );
-
-                    data_validation_log.Warning()
-                        ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
-                        ->AddToken( FTextToken::Create( LOCTEXT( "UnknownNamingConventionResult", "has no known naming convention." ) ) )
-                        ->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "UnknownClass", " Class = {ClassName}" ), arguments ) ) );
-                }
-                ++num_files_checked;
-                ++num_files_unable_to_validate;
-            }
-            break;
-        }
-    }
-
-    const auto has_failed = num_invalid_files > 0;
-
-    if ( has_failed || show_if_no_failures )
-    {
-        FFormatNamedArguments arguments;
-        arguments.Add( TEXT( "Result" ), has_failed ? LOCTEXT( "Failed", "FAILED" ) : LOCTEXT( "Succeeded", "SUCCEEDED" ) );
-        arguments.Add( TEXT( "NumChecked" ), num_files_checked );
-        arguments.Add( TEXT( "NumValid" ), num_valid_files );
-        arguments.Add( TEXT( "NumInvalid" ), num_invalid_files );
-        arguments.Add( TEXT( "NumSkipped" ), num_files_skipped );
-        arguments.Add( TEXT( "NumUnableToValidate" ), num_files_unable_to_validate );
-
-        auto validation_log = has_failed ? data_validation_log.Error() : data_validation_log.Info();
-        validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "SuccessOrFailure", "NamingConvention Validation {Result}." ), arguments ) ) );
-        validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "ResultsSummary", "Files Checked: {NumChecked}, Passed: {NumValid}, Failed: {NumInvalid}, Skipped: {NumSkipped}, Unable to validate: {NumUnableToValidate}" ), arguments ) ) );
-
-        data_validation_log.Open( EMessageSeverity::Info, true );
-    }
-
-    return num_invalid_files;
-}
-
-void UEditorNamingValidatorSubsystem::ValidateSavedPackage( const FName package_name )
-{
-    auto * settings = GetDefault< UNamingConventionValidationSettings >();
-    if ( !settings->DoesValidateOnSave || GEditor->IsAutosaving() )
-    {
-        return;
-    }
-
-    SavedPackagesToValidate.AddUnique( package_name );
-
-    GEditor->GetTimerManager()->SetTimerForNextTick( this, &UEditorNamingValidatorSubsystem::ValidateAllSavedPackages );
-}
-
-void UEditorNamingValidatorSubsystem::AddValidator( UEditorNamingValidatorBase * validator )
-{
-    if ( validator )
-    {
-        Validators.Add( validator->GetClass(), validator );
-    }
-}
-
-ENamingConventionValidationResult UEditorNamingValidatorSubsystem::IsAssetNamedCorrectly( FText & error_message, const FAssetData & asset_data, bool can_use_editor_validators ) const
-{
-    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
-    if ( settings->IsPathExcludedFromValidation( asset_data.PackageName.ToString() ) )
-    {
-        error_message = LOCTEXT( "ExcludedFolder", "The asset is in an excluded directory" );
-        return ENamingConventionValidationResult::Excluded;
-    }
-
-    FName asset_class;
-    if ( !TryGetAssetDataRealClass( asset_class, asset_data ) )
-    {
-        error_message = LOCTEXT( "UnknownClass", "The asset is of a class which has not been set up in the settings" );
-        return ENamingConventionValidationResult::Unknown;
-    }
-
-    return DoesAssetMatchNameConvention( error_message, asset_data, asset_class, can_use_editor_validators );
-}
-
-void UEditorNamingValidatorSubsystem::RegisterBlueprintValidators()
-{
-    if ( !AllowBlueprintValidators )
-    {
-        return;
-    }
-
-    // Locate all validators (include unloaded)
-    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
-    TArray< FAssetData > all_blueprint_asset_data;
-    asset_registry_module.Get().GetAssetsByClass( UEditorUtilityBlueprint::StaticClass()->GetFName(), all_blueprint_asset_data, true );
-
-    for ( auto & asset_data : all_blueprint_asset_data )
-    {
-        UClass * parent_class = nullptr;
-        FString parent_class_name;
-
-        if ( !asset_data.GetTagValue( FBlueprintTags::NativeParentClassPath, parent_class_name ) )
-        {
-            asset_data.GetTagValue( FBlueprintTags::ParentClassPath, parent_class_name );
-        }
-
-        if ( !parent_class_name.IsEmpty() )
-        {
-            UObject * outer = nullptr;
-            ResolveName( outer, parent_class_name, false, false );
-            parent_class = FindObject< UClass >( ANY_PACKAGE, *parent_class_name );
-            if ( !parent_class->IsChildOf( UEditorNamingValidatorBase::StaticClass() ) )
-            {
-                continue;
-            }
-        }
-
-        // If this object isn't currently loaded, load it
-        auto * validator_object = asset_data.ToSoftObjectPath().ResolveObject();
-        if ( validator_object == nullptr )
-        {
-            validator_object = asset_data.ToSoftObjectPath().TryLoad();
-        }
-        if ( validator_object )
-        {
-            const auto * validator_blueprint = Cast< UEditorUtilityBlueprint >( validator_object );
-            auto * validator = NewObject< UEditorNamingValidatorBase >( GetTransientPackage(), validator_blueprint->GeneratedClass );
-            AddValidator( validator );
-        }
-    }
-}
-
-void UEditorNamingValidatorSubsystem::CleanupValidators()
-{
-    Validators.Empty();
-}
-
-void UEditorNamingValidatorSubsystem::ValidateAllSavedPackages()
-{
-    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( "AssetRegistry" );
-    TArray< FAssetData > assets;
-
-    for ( const auto package_name : SavedPackagesToValidate )
-    {
-        // We need to query the in-memory data as the disk cache may not be accurate
-        asset_registry_module.Get().GetAssetsByPackageName( package_name, assets );
-    }
-
-    ValidateOnSave( assets );
-
-    SavedPackagesToValidate.Empty();
-}
-
-void UEditorNamingValidatorSubsystem::ValidateOnSave( const TArray< FAssetData > & asset_data_list ) const
-{
-    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
-    if ( !settings->DoesValidateOnSave || GEditor->IsAutosaving() )
-    {
-        return;
-    }
-
-    FMessageLog data_validation_log( "NamingConventionValidation" );
-
-    if ( ValidateAssets( asset_data_list, true, false ) > 0 )
-    {
-        const auto error_message_notification = FText::Format(
-            LOCTEXT( "ValidationFailureNotification", "Naming Convention Validation failed when saving {0}, check Naming Convention Validation log" ),
-            asset_data_list.Num() == 1 ? FText::FromName( asset_data_list[ 0 ].AssetName ) : LOCTEXT( "MultipleErrors", "multiple assets" ) );
-        data_validation_log.Notify( error_message_notification, EMessageSeverity::Warning, /*bForce=*/true );
-    }
-}
-
-ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchNameConvention( FText & error_message, const FAssetData & asset_data, const FName asset_class, bool can_use_editor_validators ) const
-{
-    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
-    const auto asset_name = asset_data.AssetName.ToString();
-    const FSoftClassPath asset_class_path( asset_class.ToString() );
-
-    if ( const auto * asset_real_class = asset_class_path.TryLoadClass< UObject >() )
-    {
-        if ( IsClassExcluded( error_message, asset_real_class ) )
-        {
-            return ENamingConventionValidationResult::Excluded;
-        }
-
-        auto result = ENamingConventionValidationResult::Unknown;
-
-        if ( can_use_editor_validators )
-        {
-            result = DoesAssetMatchesValidators( error_message, asset_real_class, asset_data );
-            if ( result != ENamingConventionValidationResult::Unknown )
-            {
-                return result;
-            }
-        }
-
-        result = DoesAssetMatchesClassDescriptions( error_message, asset_real_class, asset_name );
-        if ( result != ENamingConventionValidationResult::Unknown )
-        {
-            return result;
-        }
-    }
-
-    static const FName BlueprintClassName( "Blueprint" );
-    if ( asset_data.AssetClass == BlueprintClassName )
-    {
-        if ( !asset_name.StartsWith( settings->BlueprintsPrefix ) )
-        {
-            error_message = FText::FromString( TEXT( "Generic blueprint assets must start with BP_" ) );
-            return ENamingConventionValidationResult::Invalid;
-        }
-
-        return ENamingConventionValidationResult::Valid;
-    }
-
-    return ENamingConventionValidationResult::Unknown;
-}
-
-bool UEditorNamingValidatorSubsystem::IsClassExcluded( FText & error_message, const UClass * asset_class ) const
-{
-    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
-
-    for ( auto * excluded_class : settings->ExcludedClasses )
-    {
-        if ( asset_class->IsChildOf( excluded_class ) )
-        {
-            error_message = FText::Format( LOCTEXT( "ExcludedClass", "Assets of class '{0}' are excluded from naming convention validation" ), FText::FromString( excluded_class->GetDefaultObjectName().ToString() ) );
-            return true;
-        }
-    }
-
-    return false;
-}
-
-ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesClassDescriptions( FText & error_message, const UClass * asset_class, const FString & asset_name ) const
-{
-    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
-
-    for ( const auto & class_description : settings->ClassDescriptions )
-    {
-        if ( asset_class->IsChildOf( class_description.Class ) )
-        {
-            if ( !class_description.Prefix.IsEmpty() )
-            {
-                if ( !asset_name.StartsWith( class_description.Prefix ) )
-                {
-                    error_message = FText::Format( LOCTEXT( "WrongPrefix", "Assets of class '{0}' must have a name which starts with {1}" ), FText::FromString( class_description.ClassPath.ToString() ), FText::FromString( class_description.Prefix ) );
-                    return ENamingConventionValidationResult::Invalid;
-                }
-            }
-
-            if ( !class_description.Suffix.IsEmpty() )
-            {
-                if ( !asset_name.EndsWith( class_description.Suffix ) )
-                {
-                    error_message = FText::Format( LOCTEXT( "WrongSuffix", "Assets of class '{0}' must have a name which ends with {1}" ), FText::FromString( class_description.ClassPath.ToString() ), FText::FromString( class_description.Suffix ) );
-                    return ENamingConventionValidationResult::Invalid;
-                }
-            }
-
-            return ENamingConventionValidationResult::Valid;
-        }
-    }
-
-    return ENamingConventionValidationResult::Unknown;
-}
-
-ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesValidators( FText & error_message, const UClass * asset_class, const FAssetData & asset_data ) const
-{
-    for ( const auto & validator_pair : Validators )
-    {
-        if ( validator_pair.Value != nullptr && validator_pair.Value->IsEnabled() && validator_pair.Value->CanValidateAssetNaming( asset_class, asset_data ) )
-        {
-            const auto result = validator_pair.Value->ValidateAssetNaming( error_message, asset_class, asset_data );
-
-            if ( result != ENamingConventionValidationResult::Unknown )
-            {
-                return result;
-            }
-        }
-    }
-
-    return ENamingConventionValidationResult::Unknown;
-}
-
-#undef LOCTEXT_NAMESPACE
+#include "EditorNamingValidatorSubsystem.h"
+
+#include "NamingConventionValidationBaseline.h"
+#include "NamingConventionValidationSettings.h"
+#include "NamingConventionValidationLog.h"
+#include "SNamingConventionValidationResultsPanel.h"
+
+#include <AssetRegistryModule.h>
+#include <Async/Async.h>
+#include <Containers/Ticker.h>
+#include <Editor.h>
+#include <EditorNamingValidatorBase.h>
+#include <EditorUtilityBlueprint.h>
+#include <Framework/Application/SlateApplication.h>
+#include <Framework/Docking/TabManager.h>
+#include <Logging/MessageLog.h>
+#include <MessageLog/Public/MessageLogInitializationOptions.h>
+#include <MessageLog/Public/MessageLogModule.h>
+#include <Framework/Notifications/NotificationManager.h>
+#include <HAL/IConsoleManager.h>
+#include <Misc/ScopedSlowTask.h>
+#include <UObject/UObjectHash.h>
+#include <Widgets/Notifications/SNotificationList.h>
+
+#define LOCTEXT_NAMESPACE "NamingConventionValidationManager"
+
+static const double UpdatesBroadcastIntervalSeconds = 1.0;
+
+bool TryGetAssetDataRealClass( FName & asset_class, const FAssetData & asset_data, const bool can_load_asset )
+{
+    static const FName
+        NativeParentClassKey( "NativeParentClass" ),
+        NativeClassKey( "NativeClass" );
+
+    if ( !asset_data.GetTagValue( NativeParentClassKey, asset_class ) )
+    {
+        if ( !asset_data.GetTagValue( NativeClassKey, asset_class ) )
+        {
+            const UClass * real_class = nullptr;
+
+            if ( const auto * asset = can_load_asset ? asset_data.GetAsset() : asset_data.FastGetAsset() )
+            {
+                real_class = asset->GetClass();
+            }
+            else if ( !can_load_asset )
+            {
+                // Only blueprints have the tags, so without loading the asset, fall back on the class stored in the asset registry.
+                // Native classes are always loaded, and the assets of a blueprint class are found once the blueprint has been loaded
+                real_class = FindObject< UClass >( ANY_PACKAGE, *asset_data.AssetClass.ToString() );
+            }
+
+            if ( real_class == nullptr )
+            {
+                return false;
+            }
+
+            const FSoftClassPath class_path( real_class );
+            asset_class = *class_path.ToString();
+        }
+    }
+
+    return true;
+}
+
+void AddResultToLog( FMessageLog & log, const FAssetData & asset_data, const ENamingConventionValidationResult result, const FText & error_message, const bool log_excluded, const bool log_unknown )
+{
+    switch ( result )
+    {
+        case ENamingConventionValidationResult::Excluded:
+        {
+            if ( log_excluded )
+            {
+                log.Info()
+                    ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
+                    ->AddToken( FTextToken::Create( LOCTEXT( "ExcludedNamingConventionResult", "has not been tested based on the configuration." ) ) )
+                    ->AddToken( FTextToken::Create( error_message ) );
+            }
+        }
+        break;
+        case ENamingConventionValidationResult::Invalid:
+        {
+            log.Error()
+                ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
+                ->AddToken( FTextToken::Create( LOCTEXT( "InvalidNamingConventionResult", "does not match naming convention." ) ) )
+                ->AddToken( FTextToken::Create( error_message ) );
+        }
+        break;
+        case ENamingConventionValidationResult::Unknown:
+        {
+            if ( log_unknown )
+            {
+                FFormatNamedArguments arguments;
+                arguments.Add( TEXT( "ClassName" ), FText::FromString( asset_data.AssetClass.ToString() ) );
+
+                log.Warning()
+                    ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
+                    ->AddToken( FTextToken::Create( LOCTEXT( "UnknownNamingConventionResult", "has no known naming convention." ) ) )
+                    ->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "UnknownClass", " Class = {ClassName}" ), arguments ) ) );
+            }
+        }
+        break;
+        default:
+        {
+        }
+        break;
+    }
+}
+
+void AddSummaryToLog( FMessageLog & log, const FNamingConventionValidationStatistics & statistics )
+{
+    const auto has_failed = statistics.HasFailed();
+
+    FFormatNamedArguments arguments;
+    arguments.Add( TEXT( "Result" ), has_failed ? LOCTEXT( "Failed", "FAILED" ) : LOCTEXT( "Succeeded", "SUCCEEDED" ) );
+    arguments.Add( TEXT( "NumChecked" ), statistics.NumFilesChecked );
+    arguments.Add( TEXT( "NumValid" ), statistics.NumValidFiles );
+    arguments.Add( TEXT( "NumInvalid" ), statistics.NumInvalidFiles );
+    arguments.Add( TEXT( "NumSkipped" ), statistics.NumFilesSkipped );
+    arguments.Add( TEXT( "NumUnableToValidate" ), statistics.NumFilesUnableToValidate );
+
+    auto validation_log = has_failed ? log.Error() : log.Info();
+    validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "SuccessOrFailure", "NamingConvention Validation {Result}." ), arguments ) ) );
+    validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "ResultsSummary", "Files Checked: {NumChecked}, Passed: {NumValid}, Failed: {NumInvalid}, Skipped: {NumSkipped}, Unable to validate: {NumUnableToValidate}" ), arguments ) ) );
+
+    if ( statistics.NumSuppressedFiles > 0 )
+    {
+        validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "ResultsSummarySuppressed", ", Known violations: {0}" ), statistics.NumSuppressedFiles ) ) );
+    }
+}
+
+FName GetNameLintError( FText & error_message, const ENamingConventionValidationNameLintResult lint_result, const FString & name, const int32 error_index, const FNamingConventionValidationCompiledNameLint & name_lint )
+{
+    static const FName
+        ForbiddenCharacterRuleName( "NameLint:AllowedCharacters" ),
+        NotPascalCaseRuleName( "NameLint:PascalCaseSegments" ),
+        DoubleUnderscoreRuleName( "NameLint:DoubleUnderscores" ),
+        TooLongRuleName( "NameLint:MaxLength" );
+
+    switch ( lint_result )
+    {
+        case ENamingConventionValidationNameLintResult::ForbiddenCharacter:
+        {
+            error_message = FText::Format( LOCTEXT( "LintForbiddenCharacter", "The character '{0}' at position {1} is not allowed. Allowed characters are {2}" ), FText::FromString( name.Mid( error_index, 1 ) ), error_index, FText::FromString( name_lint.AllowedCharacters ) );
+            return ForbiddenCharacterRuleName;
+        }
+        case ENamingConventionValidationNameLintResult::NotPascalCase:
+        {
+            error_message = FText::Format( LOCTEXT( "LintNotPascalCase", "The part of the name starting at position {0} must start with an uppercase letter or a digit" ), error_index );
+            return NotPascalCaseRuleName;
+        }
+        case ENamingConventionValidationNameLintResult::DoubleUnderscore:
+        {
+            error_message = FText::Format( LOCTEXT( "LintDoubleUnderscore", "The name must not contain consecutive underscores (position {0})" ), error_index );
+            return DoubleUnderscoreRuleName;
+        }
+        case ENamingConventionValidationNameLintResult::TooLong:
+        {
+            error_message = FText::Format( LOCTEXT( "LintTooLong", "The name must not be longer than {0} characters" ), name_lint.MaxLength );
+            return TooLongRuleName;
+        }
+        default:
+        {
+            return NAME_None;
+        }
+    }
+}
+
+static FAutoConsoleCommand DumpValidatorTimingsCommand(
+    TEXT( "NamingConvention.DumpValidatorTimings" ),
+    TEXT( "Logs the time spent by each naming validator, and the validators quarantined from the validation on save." ),
+    FConsoleCommandDelegate::CreateLambda( []() {
+        if ( GEditor != nullptr )
+        {
+            if ( const auto * naming_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() )
+            {
+                naming_validator_subsystem->LogValidatorTimings();
+            }
+        }
+    } ) );
+
+void AddImpactToLog( FNamingConventionValidationTask & task, const FAssetData & asset_data, const ENamingConventionValidationResult previous_result, const ENamingConventionValidationResult result, const FText & error_message )
+{
+    const auto was_invalid = previous_result == ENamingConventionValidationResult::Invalid;
+    const auto is_invalid = result == ENamingConventionValidationResult::Invalid;
+
+    if ( is_invalid && !was_invalid )
+    {
+        ++task.NumNewlyInvalidAssets;
+
+        task.Log.Error()
+            ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
+            ->AddToken( FTextToken::Create( LOCTEXT( "NewlyInvalidResult", "does not match naming convention anymore." ) ) )
+            ->AddToken( FTextToken::Create( error_message ) );
+    }
+    else if ( was_invalid && !is_invalid )
+    {
+        ++task.NumNewlyValidAssets;
+
+        task.Log.Info()
+            ->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) )
+            ->AddToken( FTextToken::Create( LOCTEXT( "NewlyValidResult", "is not reported as badly named anymore." ) ) );
+    }
+}
+
+bool IsRunningCookCommandlet()
+{
+    return IsRunningCommandlet() && FCString::Stristr( FCommandLine::Get(), TEXT( "run=cook" ) ) != nullptr;
+}
+
+bool IsEditorIdle( const float idle_delay )
+{
+    if ( GEditor == nullptr || GEditor->PlayWorld != nullptr || !FSlateApplication::IsInitialized() )
+    {
+        return false;
+    }
+
+    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
+    if ( asset_registry_module.Get().IsLoadingAssets() )
+    {
+        return false;
+    }
+
+    const auto & slate_application = FSlateApplication::Get();
+    return slate_application.GetCurrentTime() - slate_application.GetLastUserInteractionTime() >= idle_delay;
+}
+
+UEditorNamingValidatorSubsystem::UEditorNamingValidatorSubsystem()
+{
+    AllowBlueprintValidators = true;
+    LatestRuleSetVersion = 0;
+    IsRuleSetRebuildPending = false;
+    BackgroundValidationRuleSetVersion = 0;
+    FolderVerdictsRuleSetVersion = 0;
+    LastVerdictsBroadcastTime = 0.0;
+    LastResultsBroadcastTime = 0.0;
+    HasUnbroadcastVerdicts = false;
+}
+
+void UEditorNamingValidatorSubsystem::Initialize( FSubsystemCollectionBase & /*collection*/ )
+{
+    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
+
+    if ( !asset_registry_module.Get().IsLoadingAssets() )
+    {
+        RegisterBlueprintValidators();
+    }
+    else
+    {
+        if ( !asset_registry_module.Get().OnFilesLoaded().IsBoundToObject( this ) )
+        {
+            asset_registry_module.Get().OnFilesLoaded().AddUObject( this, &UEditorNamingValidatorSubsystem::RegisterBlueprintValidators );
+        }
+    }
+
+    TArray< UClass * > validator_classes;
+    GetDerivedClasses( UEditorNamingValidatorBase::StaticClass(), validator_classes );
+    for ( auto * validator_class : validator_classes )
+    {
+        if ( !validator_class->HasAllClassFlags( CLASS_Abstract ) )
+        {
+            if ( const auto * class_package = validator_class->GetOuterUPackage() )
+            {
+                const auto module_name = FPackageName::GetShortFName( class_package->GetFName() );
+                if ( FModuleManager::Get().IsModuleLoaded( module_name ) )
+                {
+                    auto * validator = NewObject< UEditorNamingValidatorBase >( GetTransientPackage(), validator_class );
+                    AddValidator( validator );
+                }
+            }
+        }
+    }
+
+    FMessageLogInitializationOptions init_options;
+    init_options.bShowFilters = true;
+
+    auto * settings = GetMutableDefault< UNamingConventionValidationSettings >();
+
+    auto & message_log_module = FModuleManager::LoadModuleChecked< FMessageLogModule >( "MessageLog" );
+    message_log_module.RegisterLogListing( "NamingConventionValidation", LOCTEXT( "NamingConventionValidation", "Naming Convention Validation" ), init_options );
+
+    // The first rule set is built synchronously so validations can run as soon as the subsystem is initialized
+    const auto rule_set = FNamingConventionValidationRuleSet::CreateFromSettings( *settings, ++LatestRuleSetVersion );
+    rule_set->Compile();
+    PublishRuleSet( rule_set );
+
+    OnSettingChangedDelegateHandle = settings->OnSettingChanged().AddUObject( this, &UEditorNamingValidatorSubsystem::OnSettingsChanged );
+
+    if ( settings->DoesValidateDuringCook && IsRunningCookCommandlet() )
+    {
+        OnObjectSavedDelegateHandle = FCoreUObjectDelegates::OnObjectSaved.AddUObject( this, &UEditorNamingValidatorSubsystem::OnObjectSavedDuringCook );
+    }
+
+    if ( !IsRunningCommandlet() )
+    {
+        asset_registry_module.Get().OnAssetAdded().AddUObject( this, &UEditorNamingValidatorSubsystem::OnAssetAdded );
+        asset_registry_module.Get().OnAssetRenamed().AddUObject( this, &UEditorNamingValidatorSubsystem::OnAssetRenamed );
+        asset_registry_module.Get().OnAssetRemoved().AddUObject( this, &UEditorNamingValidatorSubsystem::OnAssetRemoved );
+
+        TickerDelegateHandle = FTicker::GetCoreTicker().AddTicker( FTickerDelegate::CreateUObject( this, &UEditorNamingValidatorSubsystem::Tick ) );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::Deinitialize()
+{
+    GetMutableDefault< UNamingConventionValidationSettings >()->OnSettingChanged().Remove( OnSettingChangedDelegateHandle );
+
+    if ( OnObjectSavedDelegateHandle.IsValid() )
+    {
+        FCoreUObjectDelegates::OnObjectSaved.Remove( OnObjectSavedDelegateHandle );
+        LogCookValidationSummary();
+    }
+
+    FTicker::GetCoreTicker().RemoveTicker( TickerDelegateHandle );
+    AsyncValidationTasks.Reset();
+    BackgroundValidationTask.Reset();
+
+    if ( auto * asset_registry_module = FModuleManager::GetModulePtr< FAssetRegistryModule >( TEXT( "AssetRegistry" ) ) )
+    {
+        asset_registry_module->Get().OnAssetAdded().RemoveAll( this );
+        asset_registry_module->Get().OnAssetRenamed().RemoveAll( this );
+        asset_registry_module->Get().OnAssetRemoved().RemoveAll( this );
+    }
+
+    CleanupValidators();
+
+    Super::Deinitialize();
+}
+
+void UEditorNamingValidatorSubsystem::GetAssetsToValidate( TArray< FAssetData > & asset_data_list, const TArray< FString > & package_paths ) const
+{
+    const auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) ).Get();
+
+    // Expand the sub-folders here instead of using a recursive filter, so the packages of the external actors and objects,
+    // which can be hundreds of thousands with One File Per Actor, never reach the asset data gathering nor the validation
+    FARFilter filter;
+    filter.bRecursivePaths = false;
+
+    TArray< FString > sub_paths;
+
+    for ( const auto & package_path : package_paths )
+    {
+        if ( FNamingConventionValidationRuleSet::IsExternalPackagePath( package_path ) )
+        {
+            continue;
+        }
+
+        filter.PackagePaths.Emplace( *package_path );
+
+        sub_paths.Reset();
+        asset_registry.GetSubPaths( package_path, sub_paths, true );
+
+        for ( const auto & sub_path : sub_paths )
+        {
+            if ( !FNamingConventionValidationRuleSet::IsExternalPackagePath( sub_path ) )
+            {
+                filter.PackagePaths.Emplace( *sub_path );
+            }
+        }
+    }
+
+    // An empty filter would return all the assets of the registry
+    if ( filter.PackagePaths.Num() > 0 )
+    {
+        asset_registry.GetAssets( filter, asset_data_list );
+    }
+}
+
+int32 UEditorNamingValidatorSubsystem::ValidateAssets( const TArray< FAssetData > & asset_data_list, bool /*skip_excluded_directories*/, const bool show_if_no_failures, FNamingConventionValidationBaseline * baseline )
+{
+    // Keep the rule set alive until the end of the validation, even if the settings are modified in the meantime
+    return ValidateAssetsInContext( asset_data_list, show_if_no_failures, baseline, FNamingConventionValidationContext( GetRuleSet() ) );
+}
+
+int32 UEditorNamingValidatorSubsystem::ValidateAssetsInContext( const TArray< FAssetData > & asset_data_list, const bool show_if_no_failures, FNamingConventionValidationBaseline * baseline, const FNamingConventionValidationContext & context )
+{
+    FScopedSlowTask slow_task( 1.0f, LOCTEXT( "NamingConventionValidatingDataTask", "Validating Naming Convention..." ) );
+    slow_task.Visibility = show_if_no_failures ? ESlowTaskVisibility::ForceVisible : ESlowTaskVisibility::Invisible;
+
+    if ( show_if_no_failures )
+    {
+        slow_task.MakeDialogDelayed( 0.1f );
+    }
+
+    FMessageLog data_validation_log( "NamingConventionValidation" );
+    FNamingConventionValidationStatistics statistics;
+
+    const auto num_files_to_validate = asset_data_list.Num();
+    const auto log_unknown = show_if_no_failures && context.RuleSet->LogWarningWhenNoClassDescriptionForAsset;
+
+    // The validations on save only report a few assets, they keep using the message log
+    const auto results = show_if_no_failures ? CreateResults( FText::Format( LOCTEXT( "ValidationResultsTitle", "Validation of {0} assets" ), num_files_to_validate ) ) : nullptr;
+
+    for ( const auto & asset_data : asset_data_list )
+    {
+        slow_task.EnterProgressFrame( 1.0f / num_files_to_validate, FText::Format( LOCTEXT( "ValidatingNamingConventionFilename", "Validating Naming Convention {0}" ), FText::FromString( asset_data.GetFullName() ) ) );
+
+        FText error_message;
+        FName rule_name;
+        const auto result = IsAssetNamedCorrectly( error_message, rule_name, asset_data, context );
+
+        RecordVerdict( asset_data, result, rule_name, context );
+
+        if ( result == ENamingConventionValidationResult::Invalid && baseline != nullptr && baseline->RecordViolation( asset_data.PackageName, rule_name ) )
+        {
+            statistics.AddSuppressedResult();
+            continue;
+        }
+
+        statistics.AddResult( result );
+
+        if ( results.IsValid() )
+        {
+            // Like the message log, the assets without class description are only reported when asked to
+            if ( result != ENamingConventionValidationResult::Unknown || log_unknown )
+            {
+                results->AddResult( asset_data, result, rule_name, error_message );
+            }
+        }
+        else
+        {
+            AddResultToLog( data_validation_log, asset_data, result, error_message, true, log_unknown );
+        }
+    }
+
+    BroadcastVerdictsUpdated();
+
+    if ( statistics.HasFailed() || show_if_no_failures )
+    {
+        AddSummaryToLog( data_validation_log, statistics );
+
+        if ( results.IsValid() )
+        {
+            PublishResults( results.ToSharedRef() );
+        }
+        else
+        {
+            data_validation_log.Open( EMessageSeverity::Info, true );
+        }
+    }
+
+    return statistics.NumInvalidFiles;
+}
+
+void UEditorNamingValidatorSubsystem::ValidateAssetsAsync( TArray< FAssetData > && asset_data_list )
+{
+    const auto num_files_to_validate = asset_data_list.Num();
+
+    const auto task = MakeShared< FNamingConventionValidationTask >( MoveTemp( asset_data_list ), FNamingConventionValidationContext( GetRuleSet() ) );
+    task->LogExcludedAssets = true;
+    task->LogUnknownAssets = task->Context.RuleSet->LogWarningWhenNoClassDescriptionForAsset;
+    task->Results = CreateResults( FText::Format( LOCTEXT( "ValidationResultsTitle", "Validation of {0} assets" ), num_files_to_validate ) );
+    task->Log.NewPage( FText::Format( LOCTEXT( "AsyncValidationPage", "Validation of {0} assets" ), num_files_to_validate ) );
+
+    AddNotification( task, LOCTEXT( "AsyncValidationNotification", "Validating Naming Convention..." ) );
+    AsyncValidationTasks.Add( task );
+}
+
+void UEditorNamingValidatorSubsystem::AddNotification( const TSharedRef< FNamingConventionValidationTask > & task, const FText & text ) const
+{
+    TWeakPtr< FNamingConventionValidationTask > weak_task( task );
+
+    FNotificationInfo info( text );
+    info.bFireAndForget = false;
+    info.ExpireDuration = 3.0f;
+    info.ButtonDetails.Add( FNotificationButtonInfo(
+        LOCTEXT( "AsyncValidationCancel", "Cancel" ),
+        LOCTEXT( "AsyncValidationCancelTooltip", "Stops the naming convention validation. The results found so far are kept in the message log." ),
+        FSimpleDelegate::CreateLambda( [ weak_task ]() {
+            if ( const auto pinned_task = weak_task.Pin() )
+            {
+                pinned_task->Cancel();
+            }
+        } ),
+        SNotificationItem::CS_Pending ) );
+
+    if ( const auto notification = FSlateNotificationManager::Get().AddNotification( info ) )
+    {
+        notification->SetCompletionState( SNotificationItem::CS_Pending );
+        task->Notification = notification;
+    }
+}
+
+void UEditorNamingValidatorSubsystem::ValidateSavedPackage( const FName package_name )
+{
+    for ( auto iterator = SavedPackageFrames.CreateIterator(); iterator; ++iterator )
+    {
+        if ( iterator.Value() + 1 < GFrameCounter )
+        {
+            iterator.RemoveCurrent();
+        }
+    }
+
+    SavedPackageFrames.Add( package_name, GFrameCounter );
+
+    auto * settings = GetDefault< UNamingConventionValidationSettings >();
+    if ( !settings->DoesValidateOnSave || GEditor->IsAutosaving() )
+    {
+        return;
+    }
+
+    SavedPackagesToValidate.AddUnique( package_name );
+
+    GEditor->GetTimerManager()->SetTimerForNextTick( this, &UEditorNamingValidatorSubsystem::ValidateAllSavedPackages );
+}
+
+bool UEditorNamingValidatorSubsystem::WasPackageJustSaved( const FName package_name ) const
+{
+    const auto * saved_frame = SavedPackageFrames.Find( package_name );
+    return saved_frame != nullptr && *saved_frame + 1 >= GFrameCounter;
+}
+
+void UEditorNamingValidatorSubsystem::AddValidator( UEditorNamingValidatorBase * validator )
+{
+    if ( validator )
+    {
+        Validators.Add( validator->GetClass(), validator );
+    }
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::IsAssetNamedCorrectly( FText & error_message, const FAssetData & asset_data, const bool can_use_editor_validators ) const
+{
+    FNamingConventionValidationContext context( GetRuleSet() );
+    context.CanUseEditorValidators = can_use_editor_validators;
+
+    FName rule_name;
+    return IsAssetNamedCorrectly( error_message, rule_name, asset_data, context );
+}
+
+int32 UEditorNamingValidatorSubsystem::ValidateAssetNameCollisions( const TArray< FAssetData > & asset_data_list, const bool show_if_no_failures ) const
+{
+    static const FName ObjectRedirectorClassName( "ObjectRedirector" );
+
+    const auto rule_set = GetRuleSet();
+    const auto num_assets = asset_data_list.Num();
+
+    // FName hashing and comparison are case insensitive, so names which only differ by case end up in the same group.
+    // Each group is stored as a linked list of asset indices to avoid allocating an array per name
+    TMap< FName, int32 > group_heads;
+    TArray< int32 > next_indices;
+    group_heads.Reserve( num_assets );
+    next_indices.Init( INDEX_NONE, num_assets );
+
+    for ( auto asset_index = 0; asset_index < num_assets; ++asset_index )
+    {
+        const auto & asset_data = asset_data_list[ asset_index ];
+
+        if ( asset_data.AssetClass == ObjectRedirectorClassName || rule_set->IsPathExcludedFromValidation( asset_data.PackageName.ToString() ) )
+        {
+            continue;
+        }
+
+        auto & group_head = group_heads.FindOrAdd( asset_data.AssetName, INDEX_NONE );
+        next_indices[ asset_index ] = group_head;
+        group_head = asset_index;
+    }
+
+    FMessageLog data_validation_log( "NamingConventionValidation" );
+
+    auto num_groups = 0;
+    auto num_colliding_assets = 0;
+
+    for ( const auto & group_head : group_heads )
+    {
+        if ( next_indices[ group_head.Value ] == INDEX_NONE )
+        {
+            continue;
+        }
+
+        const auto & first_asset_name = asset_data_list[ group_head.Value ].AssetName;
+        auto differs_by_case = false;
+        auto has_duplicates = false;
+        auto message = data_validation_log.Error();
+
+        for ( auto asset_index = group_head.Value; asset_index != INDEX_NONE; asset_index = next_indices[ asset_index ] )
+        {
+            const auto & asset_data = asset_data_list[ asset_index ];
+            differs_by_case |= !asset_data.AssetName.IsEqual( first_asset_name, ENameCase::CaseSensitive );
+
+            // The groups are small, so the exact duplicates can be searched among the remaining assets of the group
+            for ( auto other_index = next_indices[ asset_index ]; !has_duplicates && other_index != INDEX_NONE; other_index = next_indices[ other_index ] )
+            {
+                has_duplicates = asset_data.AssetName.IsEqual( asset_data_list[ other_index ].AssetName, ENameCase::CaseSensitive );
+            }
+
+            message->AddToken( FAssetNameToken::Create( asset_data.PackageName.ToString() ) );
+            ++num_colliding_assets;
+        }
+
+        FText collision_text;
+
+        if ( !differs_by_case )
+        {
+            collision_text = LOCTEXT( "NameDuplicate", "share the same name." );
+        }
+        else if ( has_duplicates )
+        {
+            collision_text = LOCTEXT( "NameDuplicateAndCaseCollision", "share the same name, or have names which only differ by case." );
+        }
+        else
+        {
+            collision_text = LOCTEXT( "NameCaseCollision", "have names which only differ by case." );
+        }
+
+        message->AddToken( FTextToken::Create( collision_text ) );
+        ++num_groups;
+    }
+
+    if ( num_groups > 0 || show_if_no_failures )
+    {
+        FFormatNamedArguments arguments;
+        arguments.Add( TEXT( "Result" ), num_groups > 0 ? LOCTEXT( "Failed", "FAILED" ) : LOCTEXT( "Succeeded", "SUCCEEDED" ) );
+        arguments.Add( TEXT( "NumNames" ), group_heads.Num() );
+        arguments.Add( TEXT( "NumGroups" ), num_groups );
+        arguments.Add( TEXT( "NumAssets" ), num_colliding_assets );
+
+        auto validation_log = num_groups > 0 ? data_validation_log.Error() : data_validation_log.Info();
+        validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "NameCollisionsSuccessOrFailure", "NamingConvention Name Collisions {Result}." ), arguments ) ) );
+        validation_log->AddToken( FTextToken::Create( FText::Format( LOCTEXT( "NameCollisionsSummary", "Distinct Names: {NumNames}, Collision Groups: {NumGroups}, Colliding Assets: {NumAssets}" ), arguments ) ) );
+
+        data_validation_log.Open( EMessageSeverity::Info, true );
+    }
+
+    return num_groups;
+}
+
+void UEditorNamingValidatorSubsystem::LogValidatorTimings() const
+{
+    const auto current_time = FPlatformTime::Seconds();
+
+    for ( const auto & pair : ValidatorTimings )
+    {
+        const auto & timings = pair.Value;
+
+        UE_LOG( LogNamingConventionValidation, Display, TEXT( "%s: %d calls, %.2f ms in total, %.3f ms on average, %.2f ms at most%s" ),
+            *pair.Key.ToString(),
+            timings.NumCalls,
+            timings.TotalSeconds * 1000.0,
+            timings.NumCalls > 0 ? timings.TotalSeconds * 1000.0 / timings.NumCalls : 0.0,
+            timings.MaxSeconds * 1000.0,
+            timings.IsQuarantined( current_time ) ? TEXT( ", quarantined from the save path" ) : TEXT( "" ) );
+    }
+}
+
+FNamingConventionValidationRuleSetRef UEditorNamingValidatorSubsystem::GetRuleSet() const
+{
+    FScopeLock lock( &RuleSetCriticalSection );
+    check( RuleSet.IsValid() );
+    return RuleSet.ToSharedRef();
+}
+
+const FNamingConventionValidationVerdict * UEditorNamingValidatorSubsystem::FindCurrentVerdict( const FName object_path ) const
+{
+    const auto * verdict = VerdictCache.Find( object_path );
+
+    // The verdicts the last change of rules can not affect have been promoted to the version of the current rule set
+    if ( verdict == nullptr || verdict->RuleSetVersion != GetRuleSet()->Version )
+    {
+        return nullptr;
+    }
+
+    return verdict;
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::IsAssetNamedCorrectly( FText & error_message, FName & rule_name, const FAssetData & asset_data, const FNamingConventionValidationContext & context ) const
+{
+    static const FName ExternalPackageRuleName( "ExternalPackage" );
+
+    const auto package_name = asset_data.PackageName.ToString();
+    rule_name = NAME_None;
+
+    if ( FNamingConventionValidationRuleSet::IsExternalPackagePath( package_name ) )
+    {
+        error_message = LOCTEXT( "ExternalPackage", "The asset is an external actor or object package" );
+        rule_name = ExternalPackageRuleName;
+        return ENamingConventionValidationResult::Excluded;
+    }
+
+    rule_name = context.RuleSet->FindPathExclusionRule( package_name );
+    if ( !rule_name.IsNone() )
+    {
+        error_message = LOCTEXT( "ExcludedFolder", "The asset is in an excluded directory" );
+        return ENamingConventionValidationResult::Excluded;
+    }
+
+    FName asset_class;
+    if ( !TryGetAssetDataRealClass( asset_class, asset_data, context.CanLoadAssets ) )
+    {
+        error_message = LOCTEXT( "UnknownClass", "The asset is of a class which has not been set up in the settings" );
+        return ENamingConventionValidationResult::Unknown;
+    }
+
+    return DoesAssetMatchNameConvention( error_message, rule_name, asset_data, asset_class, context );
+}
+
+void UEditorNamingValidatorSubsystem::RegisterBlueprintValidators()
+{
+    if ( !AllowBlueprintValidators )
+    {
+        return;
+    }
+
+    // Locate all validators (include unloaded)
+    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
+    TArray< FAssetData > all_blueprint_asset_data;
+    asset_registry_module.Get().GetAssetsByClass( UEditorUtilityBlueprint::StaticClass()->GetFName(), all_blueprint_asset_data, true );
+
+    for ( auto & asset_data : all_blueprint_asset_data )
+    {
+        UClass * parent_class = nullptr;
+        FString parent_class_name;
+
+        if ( !asset_data.GetTagValue( FBlueprintTags::NativeParentClassPath, parent_class_name ) )
+        {
+            asset_data.GetTagValue( FBlueprintTags::ParentClassPath, parent_class_name );
+        }
+
+        if ( !parent_class_name.IsEmpty() )
+        {
+            UObject * outer = nullptr;
+            ResolveName( outer, parent_class_name, false, false );
+            parent_class = FindObject< UClass >( ANY_PACKAGE, *parent_class_name );
+            if ( !parent_class->IsChildOf( UEditorNamingValidatorBase::StaticClass() ) )
+            {
+                continue;
+            }
+        }
+
+        // If this object isn't currently loaded, load it
+        auto * validator_object = asset_data.ToSoftObjectPath().ResolveObject();
+        if ( validator_object == nullptr )
+        {
+            validator_object = asset_data.ToSoftObjectPath().TryLoad();
+        }
+        if ( validator_object )
+        {
+            const auto * validator_blueprint = Cast< UEditorUtilityBlueprint >( validator_object );
+            auto * validator = NewObject< UEditorNamingValidatorBase >( GetTransientPackage(), validator_blueprint->GeneratedClass );
+            AddValidator( validator );
+        }
+    }
+}
+
+void UEditorNamingValidatorSubsystem::CleanupValidators()
+{
+    Validators.Empty();
+}
+
+void UEditorNamingValidatorSubsystem::ValidateAllSavedPackages()
+{
+    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( "AssetRegistry" );
+    TArray< FAssetData > assets;
+
+    for ( const auto package_name : SavedPackagesToValidate )
+    {
+        // We need to query the in-memory data as the disk cache may not be accurate
+        asset_registry_module.Get().GetAssetsByPackageName( package_name, assets );
+    }
+
+    ValidateOnSave( assets );
+
+    SavedPackagesToValidate.Empty();
+}
+
+void UEditorNamingValidatorSubsystem::ValidateOnSave( const TArray< FAssetData > & asset_data_list )
+{
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+    if ( !settings->DoesValidateOnSave || GEditor->IsAutosaving() )
+    {
+        return;
+    }
+
+    FMessageLog data_validation_log( "NamingConventionValidation" );
+
+    FNamingConventionValidationContext context( GetRuleSet() );
+    context.IsSavePath = true;
+
+    if ( ValidateAssetsInContext( asset_data_list, false, nullptr, context ) > 0 )
+    {
+        const auto error_message_notification = FText::Format(
+            LOCTEXT( "ValidationFailureNotification", "Naming Convention Validation failed when saving {0}, check Naming Convention Validation log" ),
+            asset_data_list.Num() == 1 ? FText::FromName( asset_data_list[ 0 ].AssetName ) : LOCTEXT( "MultipleErrors", "multiple assets" ) );
+        data_validation_log.Notify( error_message_notification, EMessageSeverity::Warning, /*bForce=*/true );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::OnSettingsChanged( UObject * /*settings*/, FPropertyChangedEvent & /*property_changed_event*/ )
+{
+    RequestRuleSetRebuild();
+}
+
+void UEditorNamingValidatorSubsystem::RequestRuleSetRebuild()
+{
+    // Coalesce all the changes made during the same frame (config reload, array edits, ...) into a single rebuild
+    if ( IsRuleSetRebuildPending )
+    {
+        return;
+    }
+
+    IsRuleSetRebuildPending = true;
+    GEditor->GetTimerManager()->SetTimerForNextTick( this, &UEditorNamingValidatorSubsystem::RebuildRuleSet );
+}
+
+void UEditorNamingValidatorSubsystem::RebuildRuleSet()
+{
+    IsRuleSetRebuildPending = false;
+
+    // Classes must be resolved on the game thread, the rest of the compilation happens in the background
+    const auto rule_set = FNamingConventionValidationRuleSet::CreateFromSettings( *GetDefault< UNamingConventionValidationSettings >(), ++LatestRuleSetVersion );
+
+    TWeakObjectPtr< UEditorNamingValidatorSubsystem > weak_this( this );
+
+    Async( EAsyncExecution::ThreadPool, [ weak_this, rule_set ]() {
+        rule_set->Compile();
+
+        AsyncTask( ENamedThreads::GameThread, [ weak_this, rule_set ]() {
+            if ( auto * subsystem = weak_this.Get() )
+            {
+                subsystem->PublishRuleSet( rule_set );
+            }
+        } );
+    } );
+}
+
+void UEditorNamingValidatorSubsystem::PublishRuleSet( const TSharedRef< FNamingConventionValidationRuleSet, ESPMode::ThreadSafe > & rule_set )
+{
+    check( IsInGameThread() );
+
+    // A more recent rebuild has been requested while this one was compiling: it will be published instead
+    if ( rule_set->Version != LatestRuleSetVersion )
+    {
+        return;
+    }
+
+    // The rule set is only replaced on the game thread, so it can be read here without the lock
+    const auto previous_rule_set = RuleSet;
+    FNamingConventionValidationRuleSetChanges changes;
+
+    if ( previous_rule_set.IsValid() )
+    {
+        FNamingConventionValidationRuleSet::FindChanges( *previous_rule_set, *rule_set, changes );
+
+        // Most settings are not rules (time budgets, results panel, ...). When no rule changed, the new rule set keeps the version
+        // of the previous one, so the verdicts, the running validations and the background validation all stay valid
+        if ( changes.IsEmpty() )
+        {
+            rule_set->Version = previous_rule_set->Version;
+        }
+    }
+
+    {
+        FScopeLock lock( &RuleSetCriticalSection );
+        RuleSet = rule_set;
+    }
+
+    UE_LOG( LogNamingConventionValidation, Verbose, TEXT( "Naming convention rule set version %u published (%d class descriptions, %d excluded directories)" ), rule_set->Version, rule_set->ClassDescriptions.Num(), rule_set->ExcludedDirectories.Num() );
+
+    // The classes are already loaded by the rule set, so this only fills the transient members of the settings for the code which still reads them
+    auto * settings = GetMutableDefault< UNamingConventionValidationSettings >();
+
+    for ( auto & class_description : settings->ClassDescriptions )
+    {
+        class_description.Class = class_description.ClassPath.Get();
+    }
+
+    settings->ExcludedClasses.Reset( rule_set->ExcludedClasses.Num() );
+
+    for ( const auto & excluded_class : rule_set->ExcludedClasses )
+    {
+        settings->ExcludedClasses.Add( excluded_class.Get() );
+    }
+
+    if ( !previous_rule_set.IsValid() || rule_set->Version == previous_rule_set->Version )
+    {
+        return;
+    }
+
+    // A background validation started with the previous rules would keep reporting their violations. The version of the new rule set
+    // differs from BackgroundValidationRuleSetVersion, so the next background validation goes over the whole project again
+    BackgroundValidationTask.Reset();
+    BackgroundValidationPendingPackagePaths.Reset();
+
+    // The assets the previous validation of affected assets did not reach still have a verdict from an older rule set,
+    // so they are part of the affected assets of this change
+    for ( const auto & pending_task : AsyncValidationTasks )
+    {
+        if ( pending_task->PreviousResults.Num() > 0 )
+        {
+            pending_task->Cancel();
+        }
+    }
+
+    TSet< FName > affected_object_paths;
+    GetAffectedObjectPaths( changes, previous_rule_set->Version, affected_object_paths );
+
+    // The other verdicts can not be changed by the new rules, so the next change does not consider them affected
+    VerdictCache.Promote( previous_rule_set->Version, rule_set->Version, affected_object_paths );
+
+    if ( !IsRunningCommandlet() && GetDefault< UNamingConventionValidationSettings >()->DoesValidateAffectedAssetsOnSettingsChange )
+    {
+        ValidateAffectedAssets( affected_object_paths );
+    }
+
+    // The verdicts of the affected assets are not trusted anymore
+    BroadcastVerdictsUpdated();
+}
+
+void UEditorNamingValidatorSubsystem::ValidateAffectedAssets( const TSet< FName > & object_paths )
+{
+    if ( object_paths.Num() == 0 )
+    {
+        return;
+    }
+
+    UE_LOG( LogNamingConventionValidation, Log, TEXT( "The naming convention settings change affects %d of the %d assets already validated" ), object_paths.Num(), VerdictCache.GetVerdicts().Num() );
+
+    const auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) ).Get();
+
+    TArray< FAssetData > asset_data_list;
+    TArray< ENamingConventionValidationResult > previous_results;
+    asset_data_list.Reserve( object_paths.Num() );
+    previous_results.Reserve( object_paths.Num() );
+
+    for ( const auto object_path : object_paths )
+    {
+        auto asset_data = asset_registry.GetAssetByObjectPath( object_path );
+
+        if ( !asset_data.IsValid() )
+        {
+            VerdictCache.Remove( object_path );
+            continue;
+        }
+
+        previous_results.Add( VerdictCache.Find( object_path )->Result );
+        asset_data_list.Emplace( MoveTemp( asset_data ) );
+    }
+
+    if ( asset_data_list.Num() == 0 )
+    {
+        return;
+    }
+
+    const auto task = MakeShared< FNamingConventionValidationTask >( MoveTemp( asset_data_list ), FNamingConventionValidationContext( GetRuleSet() ) );
+    task->PreviousResults = MoveTemp( previous_results );
+    task->Log.NewPage( LOCTEXT( "ImpactValidationPage", "Settings Change" ) );
+
+    AddNotification( task, LOCTEXT( "ImpactValidationNotification", "Validating the assets affected by the settings change..." ) );
+    AsyncValidationTasks.Add( task );
+}
+
+void UEditorNamingValidatorSubsystem::GetAffectedObjectPaths( const FNamingConventionValidationRuleSetChanges & changes, const uint32 old_rule_set_version, TSet< FName > & affected_object_paths ) const
+{
+    const auto & verdicts = VerdictCache.GetVerdicts();
+
+    if ( changes.AreAllAssetsAffected )
+    {
+        affected_object_paths.Reserve( verdicts.Num() );
+
+        for ( const auto & pair : verdicts )
+        {
+            affected_object_paths.Add( pair.Key );
+        }
+
+        return;
+    }
+
+    for ( const auto rule_name : changes.ChangedRuleNames )
+    {
+        if ( const auto * decided_object_paths = VerdictCache.FindObjectPathsDecidedByRule( rule_name ) )
+        {
+            affected_object_paths.Append( *decided_object_paths );
+        }
+    }
+
+    const auto are_folders_changed = changes.ChangedPathPrefixes.Num() > 0 || changes.ChangedPathPatterns.Num() > 0;
+
+    for ( const auto & pair : verdicts )
+    {
+        const auto & verdict = pair.Value;
+
+        // Verdicts older than the previous rule set come from a validation of affected assets which was cancelled
+        if ( verdict.RuleSetVersion != old_rule_set_version
+             || ( are_folders_changed && !affected_object_paths.Contains( pair.Key ) && changes.IsPackageAffected( verdict.PackageName.ToString() ) ) )
+        {
+            affected_object_paths.Add( pair.Key );
+        }
+    }
+}
+
+bool UEditorNamingValidatorSubsystem::Tick( float /*delta_time*/ )
+{
+    QUICK_SCOPE_CYCLE_COUNTER( STAT_UEditorNamingValidatorSubsystem_Tick );
+
+    TickAsyncValidations();
+    TickBackgroundValidation();
+
+    // Let the listeners see the results of the long validations while they run, without refreshing them every frame
+    if ( HasUnbroadcastVerdicts && FPlatformTime::Seconds() - LastVerdictsBroadcastTime >= UpdatesBroadcastIntervalSeconds )
+    {
+        BroadcastVerdictsUpdated();
+    }
+
+    return true;
+}
+
+void UEditorNamingValidatorSubsystem::TickAsyncValidations()
+{
+    if ( AsyncValidationTasks.Num() == 0 )
+    {
+        return;
+    }
+
+    // Tasks run one after the other, so the first one started is the first one finished
+    const auto task = AsyncValidationTasks[ 0 ];
+
+    TickValidationTask( *task, GetDefault< UNamingConventionValidationSettings >()->AsyncValidationTimeBudgetPerFrame / 1000.0 );
+
+    if ( task->IsFinished() )
+    {
+        FinishAsyncValidation( *task );
+        AsyncValidationTasks.RemoveAt( 0 );
+    }
+    else
+    {
+        // Display the results found so far in the panel, without rebuilding it every frame
+        if ( task->Results.IsValid() )
+        {
+            if ( LatestResults != task->Results )
+            {
+                PublishResults( task->Results.ToSharedRef() );
+            }
+            else if ( FPlatformTime::Seconds() - LastResultsBroadcastTime >= UpdatesBroadcastIntervalSeconds )
+            {
+                LastResultsBroadcastTime = FPlatformTime::Seconds();
+                ResultsUpdatedDelegate.Broadcast();
+            }
+        }
+
+        if ( const auto notification = task->Notification.Pin() )
+        {
+            notification->SetText( FText::Format( LOCTEXT( "AsyncValidationProgress", "Validating Naming Convention... {0} / {1}" ), task->NextAssetIndex, task->AssetDataList.Num() ) );
+        }
+    }
+}
+
+void UEditorNamingValidatorSubsystem::FinishAsyncValidation( FNamingConventionValidationTask & task )
+{
+    const auto & statistics = task.Statistics;
+
+    BroadcastVerdictsUpdated();
+
+    if ( task.PreviousResults.Num() > 0 )
+    {
+        const auto summary = FText::Format(
+            task.IsCancelled
+                ? LOCTEXT( "ImpactValidationCancelledSummary", "Naming convention settings change: validation cancelled after {0} assets, {1} newly invalid, {2} newly valid." )
+                : LOCTEXT( "ImpactValidationSummary", "Naming convention settings change: {0} assets validated again, {1} newly invalid, {2} newly valid." ),
+            task.NextAssetIndex,
+            task.NumNewlyInvalidAssets,
+            task.NumNewlyValidAssets );
+
+        task.Log.Info( summary );
+
+        if ( task.NumNewlyInvalidAssets > 0 || task.NumNewlyValidAssets > 0 )
+        {
+            task.Log.Open( EMessageSeverity::Info, true );
+        }
+
+        if ( const auto notification = task.Notification.Pin() )
+        {
+            auto completion_state = task.IsCancelled ? SNotificationItem::CS_None : SNotificationItem::CS_Success;
+
+            if ( task.NumNewlyInvalidAssets > 0 )
+            {
+                completion_state = SNotificationItem::CS_Fail;
+            }
+
+            notification->SetText( summary );
+            notification->SetCompletionState( completion_state );
+            notification->ExpireAndFadeout();
+        }
+
+        return;
+    }
+
+    if ( task.IsCancelled )
+    {
+        task.Log.Info( FText::Format( LOCTEXT( "AsyncValidationCancelled", "NamingConvention Validation cancelled after {0} of {1} files." ), task.NextAssetIndex, task.AssetDataList.Num() ) );
+    }
+
+    AddSummaryToLog( task.Log, statistics );
+
+    if ( task.Results.IsValid() )
+    {
+        task.Log.Flush();
+        PublishResults( task.Results.ToSharedRef() );
+    }
+    else
+    {
+        task.Log.Open( EMessageSeverity::Info, true );
+    }
+
+    if ( const auto notification = task.Notification.Pin() )
+    {
+        FText notification_text;
+
+        if ( task.IsCancelled )
+        {
+            notification_text = LOCTEXT( "AsyncValidationCancelledNotification", "Naming Convention Validation cancelled" );
+        }
+        else if ( statistics.HasFailed() )
+        {
+            notification_text = FText::Format( LOCTEXT( "AsyncValidationFailedNotification", "Naming Convention Validation failed: {0} badly named assets" ), statistics.NumInvalidFiles );
+        }
+        else
+        {
+            notification_text = LOCTEXT( "AsyncValidationSucceededNotification", "Naming Convention Validation succeeded" );
+        }
+
+        auto completion_state = SNotificationItem::CS_Success;
+
+        if ( statistics.HasFailed() )
+        {
+            completion_state = SNotificationItem::CS_Fail;
+        }
+        else if ( task.IsCancelled )
+        {
+            // Not all the assets have been validated, so the run did not pass
+            completion_state = SNotificationItem::CS_None;
+        }
+
+        notification->SetText( notification_text );
+        notification->SetCompletionState( completion_state );
+        notification->ExpireAndFadeout();
+    }
+}
+
+TSharedPtr< FNamingConventionValidationResults > UEditorNamingValidatorSubsystem::CreateResults( const FText & title ) const
+{
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+    if ( !settings->DoesShowResultsInPanel || IsRunningCommandlet() || !FSlateApplication::IsInitialized() )
+    {
+        return nullptr;
+    }
+
+    return MakeShared< FNamingConventionValidationResults >( title, settings->DoesListExcludedAssetsInResultsPanel );
+}
+
+void UEditorNamingValidatorSubsystem::PublishResults( const TSharedRef< FNamingConventionValidationResults > & results )
+{
+    LatestResults = results;
+    LastResultsBroadcastTime = FPlatformTime::Seconds();
+    ResultsUpdatedDelegate.Broadcast();
+
+    FGlobalTabmanager::Get()->TryInvokeTab( SNamingConventionValidationResultsPanel::TabName );
+}
+
+void UEditorNamingValidatorSubsystem::TickBackgroundValidation()
+{
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+
+    if ( !settings->DoesValidateInBackground )
+    {
+        if ( BackgroundValidationTask.IsValid() )
+        {
+            // Make sure the whole project gets validated again when the background validation is re-enabled
+            BackgroundValidationTask.Reset();
+            BackgroundValidationPendingPackagePaths.Reset();
+            BackgroundValidationRuleSetVersion = 0;
+        }
+
+        return;
+    }
+
+    if ( !IsEditorIdle( settings->BackgroundValidationIdleDelay ) )
+    {
+        return;
+    }
+
+    if ( !BackgroundValidationTask.IsValid() )
+    {
+        StartBackgroundValidation();
+
+        if ( !BackgroundValidationTask.IsValid() )
+        {
+            return;
+        }
+    }
+
+    const auto end_time = FPlatformTime::Seconds() + settings->BackgroundValidationTimeBudgetPerFrame / 1000.0;
+
+    if ( BackgroundValidationTask->IsFinished() && BackgroundValidationPendingPackagePaths.Num() > 0 )
+    {
+        GatherBackgroundValidationAssets( end_time );
+    }
+
+    TickValidationTask( *BackgroundValidationTask, FMath::Max( end_time - FPlatformTime::Seconds(), 0.0 ) );
+
+    if ( !BackgroundValidationTask->IsFinished() || BackgroundValidationPendingPackagePaths.Num() > 0 )
+    {
+        return;
+    }
+
+    const auto & statistics = BackgroundValidationTask->Statistics;
+
+    BroadcastVerdictsUpdated();
+
+    UE_LOG( LogNamingConventionValidation, Log, TEXT( "Background naming convention validation finished: %d files checked, %d failed" ), statistics.NumFilesChecked, statistics.NumInvalidFiles );
+
+    if ( statistics.HasFailed() )
+    {
+        AddSummaryToLog( BackgroundValidationTask->Log, statistics );
+        BackgroundValidationTask->Log.Notify( LOCTEXT( "BackgroundValidationFailureNotification", "Background Naming Convention Validation found badly named assets, check Naming Convention Validation log" ), EMessageSeverity::Warning );
+    }
+
+    BackgroundValidationTask.Reset();
+}
+
+void UEditorNamingValidatorSubsystem::StartBackgroundValidation()
+{
+    const auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) ).Get();
+    const auto rule_set = GetRuleSet();
+    const auto is_full_validation = rule_set->Version != BackgroundValidationRuleSetVersion;
+
+    TArray< FAssetData > asset_data_list;
+
+    if ( is_full_validation )
+    {
+        // Listing all the assets of a large project at once would take far more than the frame budget,
+        // so the folders are listed a few at a time by GatherBackgroundValidationAssets
+        BackgroundValidationPendingPackagePaths.Reset();
+        BackgroundValidationPendingPackagePaths.Emplace( TEXT( "/Game" ) );
+
+        BackgroundValidationDirtyPackageNames.Reset();
+    }
+    else if ( BackgroundValidationDirtyPackageNames.Num() > 0 )
+    {
+        for ( const auto package_name : BackgroundValidationDirtyPackageNames )
+        {
+            asset_registry.GetAssetsByPackageName( package_name, asset_data_list );
+        }
+
+        BackgroundValidationDirtyPackageNames.Reset();
+    }
+
+    if ( asset_data_list.Num() == 0 && BackgroundValidationPendingPackagePaths.Num() == 0 )
+    {
+        return;
+    }
+
+    FNamingConventionValidationContext context( rule_set );
+
+    // Loading an asset would blow the frame budget
+    context.CanLoadAssets = false;
+
+    BackgroundValidationTask = MakeUnique< FNamingConventionValidationTask >( MoveTemp( asset_data_list ), context );
+    BackgroundValidationTask->LogUnknownAssets = rule_set->LogWarningWhenNoClassDescriptionForAsset;
+    BackgroundValidationRuleSetVersion = rule_set->Version;
+
+    if ( is_full_validation )
+    {
+        BackgroundValidationTask->Log.NewPage( LOCTEXT( "BackgroundValidationPage", "Background Validation" ) );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::GatherBackgroundValidationAssets( const double end_time )
+{
+    const auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) ).Get();
+
+    FARFilter filter;
+    filter.bRecursivePaths = false;
+
+    TArray< FString > sub_paths;
+
+    // Always list at least one folder so the validation progresses even with a tiny budget
+    do
+    {
+        const auto package_path = BackgroundValidationPendingPackagePaths.Pop( false );
+
+        sub_paths.Reset();
+        asset_registry.GetSubPaths( package_path, sub_paths, false );
+
+        // Same as GetAssetsToValidate, the folders of the external packages are never listed
+        for ( auto & sub_path : sub_paths )
+        {
+            if ( !FNamingConventionValidationRuleSet::IsExternalPackagePath( sub_path ) )
+            {
+                BackgroundValidationPendingPackagePaths.Emplace( MoveTemp( sub_path ) );
+            }
+        }
+
+        filter.PackagePaths.Reset();
+        filter.PackagePaths.Emplace( *package_path );
+        asset_registry.GetAssets( filter, BackgroundValidationTask->AssetDataList );
+    } while ( BackgroundValidationTask->IsFinished() && BackgroundValidationPendingPackagePaths.Num() > 0 && FPlatformTime::Seconds() < end_time );
+}
+
+void UEditorNamingValidatorSubsystem::OnObjectSavedDuringCook( UObject * object )
+{
+    if ( object == nullptr || !object->IsAsset() )
+    {
+        return;
+    }
+
+    // The asset is already loaded by the cook, so there is no registry query and no load
+    const FAssetData asset_data( object );
+
+    // The cook saves the same package once per target platform. A package can contain several assets, which are all validated
+    auto is_already_validated = false;
+    CookValidatedObjectPaths.Add( asset_data.ObjectPath, &is_already_validated );
+
+    if ( is_already_validated )
+    {
+        return;
+    }
+
+    const FNamingConventionValidationContext context( GetRuleSet() );
+
+    FText error_message;
+    FName rule_name;
+    const auto result = IsAssetNamedCorrectly( error_message, rule_name, asset_data, context );
+
+    CookValidationStatistics.AddResult( result );
+
+    UE_CLOG( result == ENamingConventionValidationResult::Invalid, LogNamingConventionValidation, Warning, TEXT( "%s does not match naming convention. %s" ), *asset_data.PackageName.ToString(), *error_message.ToString() );
+}
+
+void UEditorNamingValidatorSubsystem::LogCookValidationSummary() const
+{
+    const auto & statistics = CookValidationStatistics;
+
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "NamingConvention Validation during cook %s. Files Checked: %d, Passed: %d, Failed: %d, Skipped: %d, Unable to validate: %d" ),
+        statistics.HasFailed() ? TEXT( "FAILED" ) : TEXT( "SUCCEEDED" ),
+        statistics.NumFilesChecked,
+        statistics.NumValidFiles,
+        statistics.NumInvalidFiles,
+        statistics.NumFilesSkipped,
+        statistics.NumFilesUnableToValidate );
+}
+
+void UEditorNamingValidatorSubsystem::OnAssetAdded( const FAssetData & asset_data )
+{
+    const auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
+
+    // The initial scan is covered by the first full validation
+    if ( !asset_registry_module.Get().IsLoadingAssets()
+         && GetDefault< UNamingConventionValidationSettings >()->DoesValidateInBackground
+         && !FNamingConventionValidationRuleSet::IsExternalPackagePath( asset_data.PackageName.ToString() ) )
+    {
+        BackgroundValidationDirtyPackageNames.Add( asset_data.PackageName );
+    }
+}
+
+void UEditorNamingValidatorSubsystem::OnAssetRenamed( const FAssetData & asset_data, const FString & old_object_path )
+{
+    if ( VerdictCache.Remove( FName( *old_object_path ) ) )
+    {
+        BroadcastVerdictsUpdated();
+    }
+
+    OnAssetAdded( asset_data );
+}
+
+void UEditorNamingValidatorSubsystem::OnAssetRemoved( const FAssetData & asset_data )
+{
+    if ( VerdictCache.Remove( asset_data.ObjectPath ) )
+    {
+        BroadcastVerdictsUpdated();
+    }
+}
+
+void UEditorNamingValidatorSubsystem::TickValidationTask( FNamingConventionValidationTask & task, const double time_budget_seconds )
+{
+    if ( task.IsFinished() )
+    {
+        return;
+    }
+
+    const auto end_time = FPlatformTime::Seconds() + time_budget_seconds;
+
+    // Always validate at least one asset so the task progresses even with a tiny budget
+    do
+    {
+        const auto asset_index = task.NextAssetIndex++;
+        const auto & asset_data = task.AssetDataList[ asset_index ];
+
+        FText error_message;
+        FName rule_name;
+        const auto result = IsAssetNamedCorrectly( error_message, rule_name, asset_data, task.Context );
+
+        task.Statistics.AddResult( result );
+        RecordVerdict( asset_data, result, rule_name, task.Context );
+
+        if ( task.PreviousResults.Num() > 0 )
+        {
+            AddImpactToLog( task, asset_data, task.PreviousResults[ asset_index ], result, error_message );
+        }
+        else if ( task.Results.IsValid() )
+        {
+            if ( result != ENamingConventionValidationResult::Unknown || task.LogUnknownAssets )
+            {
+                task.Results->AddResult( asset_data, result, rule_name, error_message );
+            }
+        }
+        else
+        {
+            AddResultToLog( task.Log, asset_data, result, error_message, task.LogExcludedAssets, task.LogUnknownAssets );
+        }
+    } while ( !task.IsFinished() && FPlatformTime::Seconds() < end_time );
+
+    task.Log.Flush();
+}
+
+void UEditorNamingValidatorSubsystem::RecordVerdict( const FAssetData & asset_data, const ENamingConventionValidationResult result, const FName rule_name, const FNamingConventionValidationContext & context )
+{
+    // The tasks started before a settings change keep validating with the previous rules. Their results would mix rule set versions
+    // in the cache, and the next changes would be analyzed against them
+    if ( context.RuleSet->Version != GetRuleSet()->Version )
+    {
+        return;
+    }
+
+    VerdictCache.Record( asset_data.ObjectPath, asset_data.PackageName, result, rule_name, context.RuleSet->Version );
+    HasUnbroadcastVerdicts = true;
+}
+
+void UEditorNamingValidatorSubsystem::BroadcastVerdictsUpdated()
+{
+    HasUnbroadcastVerdicts = false;
+    LastVerdictsBroadcastTime = FPlatformTime::Seconds();
+    VerdictsUpdatedDelegate.Broadcast();
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchNameConvention( FText & error_message, FName & rule_name, const FAssetData & asset_data, const FName asset_class, const FNamingConventionValidationContext & context ) const
+{
+    static const FName BlueprintRuleName( "BlueprintsPrefix" );
+
+    const auto & rule_set = *context.RuleSet;
+    const auto asset_name = asset_data.AssetName.ToString();
+    const FSoftClassPath asset_class_path( asset_class.ToString() );
+
+    if ( const auto * asset_real_class = asset_class_path.TryLoadClass< UObject >() )
+    {
+        if ( IsClassExcluded( error_message, rule_name, asset_real_class, rule_set ) )
+        {
+            return ENamingConventionValidationResult::Excluded;
+        }
+
+        auto result = DoesAssetMatchNameLint( error_message, rule_name, asset_name, rule_set );
+        if ( result == ENamingConventionValidationResult::Invalid )
+        {
+            return result;
+        }
+
+        result = DoesAssetMatchFolderRules( error_message, rule_name, asset_real_class, asset_data, rule_set );
+        if ( result == ENamingConventionValidationResult::Invalid )
+        {
+            return result;
+        }
+
+        if ( context.CanUseEditorValidators )
+        {
+            result = DoesAssetMatchesValidators( error_message, rule_name, asset_real_class, asset_data, context );
+            if ( result != ENamingConventionValidationResult::Unknown )
+            {
+                return result;
+            }
+        }
+
+        result = DoesAssetMatchesClassDescriptions( error_message, rule_name, asset_real_class, asset_name, rule_set );
+        if ( result != ENamingConventionValidationResult::Unknown )
+        {
+            return result;
+        }
+    }
+
+    static const FName BlueprintClassName( "Blueprint" );
+    if ( asset_data.AssetClass == BlueprintClassName )
+    {
+        rule_name = BlueprintRuleName;
+
+        if ( !asset_name.StartsWith( rule_set.BlueprintsPrefix ) )
+        {
+            error_message = FText::FromString( TEXT( "Generic blueprint assets must start with BP_" ) );
+            return ENamingConventionValidationResult::Invalid;
+        }
+
+        return ENamingConventionValidationResult::Valid;
+    }
+
+    rule_name = NAME_None;
+    return ENamingConventionValidationResult::Unknown;
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchNameLint( FText & error_message, FName & rule_name, const FString & asset_name, const FNamingConventionValidationRuleSet & rule_set ) const
+{
+    const auto & name_lint = rule_set.NameLint;
+    if ( !name_lint.IsEnabled() )
+    {
+        return ENamingConventionValidationResult::Unknown;
+    }
+
+    auto error_index = 0;
+    const auto lint_result = name_lint.Lint( *asset_name, asset_name.Len(), error_index );
+
+    if ( lint_result == ENamingConventionValidationNameLintResult::Valid )
+    {
+        return ENamingConventionValidationResult::Valid;
+    }
+
+    rule_name = GetNameLintError( error_message, lint_result, asset_name, error_index, name_lint );
+    return ENamingConventionValidationResult::Invalid;
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchFolderRules( FText & error_message, FName & rule_name, const UClass * asset_class, const FAssetData & asset_data, const FNamingConventionValidationRuleSet & rule_set ) const
+{
+    if ( rule_set.FolderRules.Num() == 0 && !rule_set.DoesValidateFolderNames )
+    {
+        return ENamingConventionValidationResult::Unknown;
+    }
+
+    const auto & verdict = FindFolderVerdict( asset_data.PackagePath, rule_set );
+
+    if ( !verdict.FolderNameRuleName.IsNone() )
+    {
+        rule_name = verdict.FolderNameRuleName;
+        error_message = verdict.FolderNameErrorMessage;
+        return ENamingConventionValidationResult::Invalid;
+    }
+
+    if ( verdict.FolderRuleIndices.Num() == 0 )
+    {
+        return ENamingConventionValidationResult::Unknown;
+    }
+
+    const auto asset_name = asset_data.AssetName.ToString();
+
+    for ( const auto folder_rule_index : verdict.FolderRuleIndices )
+    {
+        const auto & folder_rule = rule_set.FolderRules[ folder_rule_index ];
+
+        if ( !folder_rule.RequiredKeyword.IsEmpty() && !asset_name.Contains( folder_rule.RequiredKeyword, ESearchCase::CaseSensitive ) )
+        {
+            rule_name = folder_rule.RuleName;
+            error_message = FText::Format( LOCTEXT( "FolderRuleMissingKeyword", "Assets in the folders matching {0} must have a name which contains {1}" ), FText::FromString( folder_rule.PathPattern ), FText::FromString( folder_rule.RequiredKeyword ) );
+            return ENamingConventionValidationResult::Invalid;
+        }
+
+        if ( !folder_rule.IsClassAllowed( asset_class ) )
+        {
+            rule_name = folder_rule.RuleName;
+            error_message = FText::Format( LOCTEXT( "FolderRuleForbiddenClass", "Assets of class '{0}' are not allowed in the folders matching {1}" ), FText::FromString( asset_class->GetName() ), FText::FromString( folder_rule.PathPattern ) );
+            return ENamingConventionValidationResult::Invalid;
+        }
+    }
+
+    return ENamingConventionValidationResult::Valid;
+}
+
+const FNamingConventionValidationFolderVerdict & UEditorNamingValidatorSubsystem::FindFolderVerdict( const FName package_path, const FNamingConventionValidationRuleSet & rule_set ) const
+{
+    check( IsInGameThread() );
+
+    if ( FolderVerdictsRuleSetVersion != rule_set.Version )
+    {
+        FolderVerdicts.Reset();
+        FolderVerdictsRuleSetVersion = rule_set.Version;
+    }
+
+    if ( const auto * verdict = FolderVerdicts.Find( package_path ) )
+    {
+        return *verdict;
+    }
+
+    FNamingConventionValidationFolderVerdict verdict;
+    const auto package_path_string = package_path.ToString();
+
+    rule_set.FindFolderRules( package_path_string, verdict.FolderRuleIndices );
+
+    if ( rule_set.DoesValidateFolderNames && rule_set.NameLint.IsEnabled() )
+    {
+        // The content root, like /Game, can not be renamed so only the folders below it are checked
+        auto segment_start = package_path_string.Find( TEXT( "/" ), ESearchCase::CaseSensitive, ESearchDir::FromStart, 1 );
+
+        while ( segment_start != INDEX_NONE )
+        {
+            ++segment_start;
+
+            const auto segment_end = package_path_string.Find( TEXT( "/" ), ESearchCase::CaseSensitive, ESearchDir::FromStart, segment_start );
+            const auto segment_length = ( segment_end == INDEX_NONE ? package_path_string.Len() : segment_end ) - segment_start;
+
+            auto error_index = 0;
+            const auto lint_result = rule_set.NameLint.Lint( *package_path_string + segment_start, segment_length, error_index );
+
+            if ( lint_result != ENamingConventionValidationNameLintResult::Valid )
+            {
+                const auto folder_path = package_path_string.Left( segment_start + segment_length );
+
+                FText lint_error_message;
+                GetNameLintError( lint_error_message, lint_result, package_path_string.Mid( segment_start, segment_length ), error_index, rule_set.NameLint );
+
+                verdict.FolderNameRuleName = FName( *FString::Printf( TEXT( "FolderName:%s" ), *folder_path ) );
+                verdict.FolderNameErrorMessage = FText::Format( LOCTEXT( "InvalidFolderName", "The name of the folder {0} does not match naming convention. {1}" ), FText::FromString( folder_path ), lint_error_message );
+                break;
+            }
+
+            segment_start = segment_end;
+        }
+    }
+
+    return FolderVerdicts.Emplace( package_path, MoveTemp( verdict ) );
+}
+
+bool UEditorNamingValidatorSubsystem::IsClassExcluded( FText & error_message, FName & rule_name, const UClass * asset_class, const FNamingConventionValidationRuleSet & rule_set ) const
+{
+    if ( const auto * excluded_class = rule_set.FindExcludedClass( asset_class, rule_name ) )
+    {
+        error_message = FText::Format( LOCTEXT( "ExcludedClass", "Assets of class '{0}' are excluded from naming convention validation" ), FText::FromString( excluded_class->GetDefaultObjectName().ToString() ) );
+        return true;
+    }
+
+    return false;
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesClassDescriptions( FText & error_message, FName & rule_name, const UClass * asset_class, const FString & asset_name, const FNamingConventionValidationRuleSet & rule_set ) const
+{
+    const auto * class_description = rule_set.FindClassDescription( asset_class );
+    if ( class_description == nullptr )
+    {
+        return ENamingConventionValidationResult::Unknown;
+    }
+
+    rule_name = class_description->RuleName;
+
+    if ( !class_description->Prefix.IsEmpty() )
+    {
+        if ( !asset_name.StartsWith( class_description->Prefix ) )
+        {
+            error_message = FText::Format( LOCTEXT( "WrongPrefix", "Assets of class '{0}' must have a name which starts with {1}" ), FText::FromString( class_description->ClassPath ), FText::FromString( class_description->Prefix ) );
+            return ENamingConventionValidationResult::Invalid;
+        }
+    }
+
+    if ( !class_description->Suffix.IsEmpty() )
+    {
+        if ( !asset_name.EndsWith( class_description->Suffix ) )
+        {
+            error_message = FText::Format( LOCTEXT( "WrongSuffix", "Assets of class '{0}' must have a name which ends with {1}" ), FText::FromString( class_description->ClassPath ), FText::FromString( class_description->Suffix ) );
+            return ENamingConventionValidationResult::Invalid;
+        }
+    }
+
+    return ENamingConventionValidationResult::Valid;
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesValidators( FText & error_message, FName & rule_name, const UClass * asset_class, const FAssetData & asset_data, const FNamingConventionValidationContext & context ) const
+{
+    const auto current_time = FPlatformTime::Seconds();
+
+    for ( const auto & validator_pair : Validators )
+    {
+        auto * validator = validator_pair.Value;
+
+        if ( validator == nullptr || !validator->IsEnabled() )
+        {
+            continue;
+        }
+
+        // The rules of the validators are named after their class
+        const auto validator_name = validator_pair.Key->GetFName();
+
+        if ( context.IsSavePath )
+        {
+            const auto * timings = ValidatorTimings.Find( validator_name );
+            if ( timings != nullptr && timings->IsQuarantined( current_time ) )
+            {
+                continue;
+            }
+        }
+
+        const auto start_time = FPlatformTime::Seconds();
+        auto result = ENamingConventionValidationResult::Unknown;
+
+        if ( validator->CanValidateAssetNaming( asset_class, asset_data ) )
+        {
+            result = validator->ValidateAssetNaming( error_message, asset_class, asset_data );
+        }
+
+        UpdateValidatorTimings( validator_name, FPlatformTime::Seconds() - start_time, context );
+
+        if ( result != ENamingConventionValidationResult::Unknown )
+        {
+            rule_name = validator_name;
+            return result;
+        }
+    }
+
+    return ENamingConventionValidationResult::Unknown;
+}
+
+void UEditorNamingValidatorSubsystem::UpdateValidatorTimings( const FName validator_name, const double elapsed_seconds, const FNamingConventionValidationContext & context ) const
+{
+    auto & timings = ValidatorTimings.FindOrAdd( validator_name );
+    timings.TotalSeconds += elapsed_seconds;
+    timings.MaxSeconds = FMath::Max( timings.MaxSeconds, elapsed_seconds );
+    ++timings.NumCalls;
+
+    if ( !context.IsSavePath )
+    {
+        return;
+    }
+
+    if ( timings.SaveBatchFrame != GFrameCounter )
+    {
+        timings.SaveBatchFrame = GFrameCounter;
+        timings.SaveBatchSeconds = 0.0;
+    }
+
+    timings.SaveBatchSeconds += elapsed_seconds;
+
+    const auto * settings = GetDefault< UNamingConventionValidationSettings >();
+    const auto is_over_call_budget = settings->SaveValidatorTimeBudgetPerCall > 0.0f && elapsed_seconds * 1000.0 > settings->SaveValidatorTimeBudgetPerCall;
+    const auto is_over_batch_budget = settings->SaveValidatorTimeBudgetPerBatch > 0.0f && timings.SaveBatchSeconds * 1000.0 > settings->SaveValidatorTimeBudgetPerBatch;
+
+    if ( !is_over_call_budget && !is_over_batch_budget )
+    {
+        return;
+    }
+
+    const auto current_time = FPlatformTime::Seconds();
+    timings.QuarantineEndTime = settings->SaveValidatorQuarantineDuration > 0.0f ? current_time + settings->SaveValidatorQuarantineDuration : MAX_dbl;
+
+    const auto warning_message = FText::Format(
+        LOCTEXT( "ValidatorQuarantined", "The naming validator {0} took {1} ms to validate {2} and is not used on save anymore. It is still used by the explicit validations." ),
+        FText::FromName( validator_name ),
+        FText::AsNumber( ( is_over_call_budget ? elapsed_seconds : timings.SaveBatchSeconds ) * 1000.0 ),
+        is_over_call_budget ? LOCTEXT( "ValidatorQuarantinedOneAsset", "a single asset" ) : LOCTEXT( "ValidatorQuarantinedSavedAssets", "the saved assets" ) );
+
+    UE_LOG( LogNamingConventionValidation, Warning, TEXT( "%s" ), *warning_message.ToString() );
+    FMessageLog( "NamingConventionValidation" ).Warning( warning_message );
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,52 @@
+#include "NamingConventionDataValidator.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationSettings.h"
+
+#include <Editor.h>
+
+#define LOCTEXT_NAMESPACE "NamingConventionDataValidator"
+
+bool UNamingConventionDataValidator::IsEnabled() const
+{
+    return Super::IsEnabled() && GetDefault< UNamingConventionValidationSettings >()->DoesValidateWithDataValidation;
+}
+
+bool UNamingConventionDataValidator::CanValidateAsset_Implementation( UObject * asset ) const
+{
+    return asset != nullptr && GEditor != nullptr && GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() != nullptr;
+}
+
+EDataValidationResult UNamingConventionDataValidator::ValidateLoadedAsset_Implementation( UObject * asset, TArray< FText > & validation_errors )
+{
+    const auto * naming_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
+
+    // The DataValidation plugin validates the saved packages during the next frame, like the subsystem does.
+    // Use the save path in that case, so the slow validators are skipped and timed the same way
+    FNamingConventionValidationContext context( naming_validator_subsystem->GetRuleSet() );
+    context.IsSavePath = naming_validator_subsystem->WasPackageJustSaved( asset->GetOutermost()->GetFName() );
+
+    FText error_message;
+    FName rule_name;
+    const auto result = naming_validator_subsystem->IsAssetNamedCorrectly( error_message, rule_name, FAssetData( asset ), context );
+
+    switch ( result )
+    {
+        case ENamingConventionValidationResult::Invalid:
+        {
+            AssetFails( asset, FText::Format( LOCTEXT( "InvalidNamingConvention", "Does not match naming convention. {0}" ), error_message ), validation_errors );
+            return EDataValidationResult::Invalid;
+        }
+        case ENamingConventionValidationResult::Valid:
+        {
+            AssetPasses( asset );
+            return EDataValidationResult::Valid;
+        }
+        default:
+        {
+            return EDataValidationResult::NotValidated;
+        }
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,89 @@
+#include "NamingConventionFrontendFilter.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+
+#include <ContentBrowserItem.h>
+#include <Editor.h>
+
+#define LOCTEXT_NAMESPACE "NamingConventionFrontendFilter"
+
+FNamingConventionFrontendFilter::FNamingConventionFrontendFilter( TSharedPtr< FFrontendFilterCategory > category ) :
+    FFrontendFilter( category )
+{
+}
+
+FNamingConventionFrontendFilter::~FNamingConventionFrontendFilter()
+{
+    ActiveStateChanged( false );
+}
+
+FString FNamingConventionFrontendFilter::GetName() const
+{
+    return TEXT( "NamingConventionViolations" );
+}
+
+FText FNamingConventionFrontendFilter::GetDisplayName() const
+{
+    return LOCTEXT( "DisplayName", "Naming Violations" );
+}
+
+FText FNamingConventionFrontendFilter::GetToolTipText() const
+{
+    return LOCTEXT( "ToolTip", "Show only the assets which did not match naming convention the last time they were validated. Enable the background validation in the settings to know the results of all the assets, and to validate them again after a settings change." );
+}
+
+FLinearColor FNamingConventionFrontendFilter::GetColor() const
+{
+    return FLinearColor::Red;
+}
+
+void FNamingConventionFrontendFilter::ActiveStateChanged( const bool active )
+{
+    if ( auto * naming_validator_subsystem = NamingValidatorSubsystem.Get() )
+    {
+        naming_validator_subsystem->OnVerdictsUpdated().Remove( OnVerdictsUpdatedDelegateHandle );
+    }
+
+    NamingValidatorSubsystem = nullptr;
+    OnVerdictsUpdatedDelegateHandle.Reset();
+
+    if ( active && GEditor != nullptr )
+    {
+        if ( auto * naming_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() )
+        {
+            NamingValidatorSubsystem = naming_validator_subsystem;
+            OnVerdictsUpdatedDelegateHandle = naming_validator_subsystem->OnVerdictsUpdated().AddRaw( this, &FNamingConventionFrontendFilter::OnVerdictsUpdated );
+        }
+    }
+}
+
+bool FNamingConventionFrontendFilter::PassesFilter( FAssetFilterType item ) const
+{
+    const auto * naming_validator_subsystem = NamingValidatorSubsystem.Get();
+    if ( naming_validator_subsystem == nullptr )
+    {
+        return false;
+    }
+
+    FAssetData asset_data;
+    if ( !item.Legacy_TryGetAssetData( asset_data ) )
+    {
+        return false;
+    }
+
+    // The verdicts which the last settings change may have made wrong are not shown
+    const auto * verdict = naming_validator_subsystem->FindCurrentVerdict( asset_data.ObjectPath );
+    return verdict != nullptr && verdict->Result == ENamingConventionValidationResult::Invalid;
+}
+
+void FNamingConventionFrontendFilter::OnVerdictsUpdated()
+{
+    BroadcastChangedEvent();
+}
+
+void UNamingConventionContentBrowserFilterExtension::AddFrontEndFilterExtensions( TSharedPtr< FFrontendFilterCategory > default_category, TArray< TSharedRef< FFrontendFilter > > & filters ) const
+{
+    filters.Add( MakeShared< FNamingConventionFrontendFilter >( default_category ) );
+}
+
+#undef LOCTEXT_NAMESPACE
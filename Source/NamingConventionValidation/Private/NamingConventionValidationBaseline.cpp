@@ -0,0 +1,74 @@
+#include "NamingConventionValidationBaseline.h"
+
+#include "NamingConventionValidationLog.h"
+
+#include <Misc/FileHelper.h>
+
+bool FNamingConventionValidationBaseline::LoadFromFile( const FString & path )
+{
+    TArray< FString > lines;
+    if ( !FFileHelper::LoadFileToStringArray( lines, *path ) )
+    {
+        return false;
+    }
+
+    Entries.Reset();
+    Entries.Reserve( lines.Num() );
+
+    for ( const auto & line : lines )
+    {
+        if ( line.IsEmpty() || line.StartsWith( TEXT( "#" ) ) )
+        {
+            continue;
+        }
+
+        FString package_name;
+        FString rule_name;
+
+        if ( !line.Split( TEXT( "\t" ), &package_name, &rule_name ) )
+        {
+            UE_LOG( LogNamingConventionValidation, Warning, TEXT( "Ignoring the malformed line '%s' of the baseline %s" ), *line, *path );
+            continue;
+        }
+
+        Entries.Emplace( FName( *package_name ), FName( *rule_name ) );
+    }
+
+    return true;
+}
+
+bool FNamingConventionValidationBaseline::SaveViolationsToFile( const FString & path ) const
+{
+    TArray< FString > lines;
+    lines.Reserve( Violations.Num() );
+
+    for ( const auto & violation : Violations )
+    {
+        lines.Emplace( FString::Printf( TEXT( "%s\t%s" ), *violation.PackageName.ToString(), *violation.RuleName.ToString() ) );
+    }
+
+    // Sorted so the file can be diffed when it is submitted with the project
+    lines.Sort();
+    lines.Insert( TEXT( "# Naming convention violations baseline: <package name>\\t<rule name>" ), 0 );
+
+    return FFileHelper::SaveStringArrayToFile( lines, *path );
+}
+
+bool FNamingConventionValidationBaseline::RecordViolation( const FName package_name, const FName rule_name )
+{
+    const FNamingConventionValidationBaselineEntry entry( package_name, rule_name );
+
+    Violations.Add( entry );
+    return Entries.Contains( entry );
+}
+
+void FNamingConventionValidationBaseline::GetStaleEntries( TArray< FNamingConventionValidationBaselineEntry > & stale_entries ) const
+{
+    for ( const auto & entry : Entries )
+    {
+        if ( !Violations.Contains( entry ) )
+        {
+            stale_entries.Add( entry );
+        }
+    }
+}
@@ -1,56 +1,104 @@
-#include "NamingConventionValidationCommandlet.h"
-
-#include "NamingConventionValidationLog.h"
-#include "EditorNamingValidatorSubsystem.h"
-
-#include <Editor.h>
-#include <AssetRegistryHelpers.h>
-#include <AssetRegistryModule.h>
-#include <IAssetRegistry.h>
-
-UNamingConventionValidationCommandlet::UNamingConventionValidationCommandlet()
-{
-    LogToConsole = false;
-}
-
-int32 UNamingConventionValidationCommandlet::Main( const FString & params )
-{
-    UE_LOG( LogNamingConventionValidation, Log, TEXT( "--------------------------------------------------------------------------------------------" ) );
-    UE_LOG( LogNamingConventionValidation, Log, TEXT( "Running NamingConventionValidation Commandlet" ) );
-    TArray< FString > tokens;
-    TArray< FString > switches;
-    TMap< FString, FString > params_map;
-    ParseCommandLine( *params, tokens, switches, params_map );
-
-    // validate data
-    if ( !ValidateData() )
-    {
-        UE_LOG( LogNamingConventionValidation, Warning, TEXT( "Errors occurred while validating naming convention" ) );
-        return 2; // return something other than 1 for error since the engine will return 1 if any other system (possibly unrelated) logged errors during execution.
-    }
-
-    UE_LOG( LogNamingConventionValidation, Log, TEXT( "Successfully finished running NamingConventionValidation Commandlet" ) );
-    UE_LOG( LogNamingConventionValidation, Log, TEXT( "--------------------------------------------------------------------------------------------" ) );
-    return 0;
-}
-
-//static
-bool UNamingConventionValidationCommandlet::ValidateData()
-{
-    auto & asset_registry_module = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( AssetRegistryConstants::ModuleName );
-
-    TArray< FAssetData > asset_data_list;
-
-    FARFilter filter;
-    filter.bRecursivePaths = true;
-    filter.PackagePaths.Add( "/Game" );
-    asset_registry_module.Get().GetAssets( filter, asset_data_list );
-
-    auto * editor_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
-    check( editor_validator_subsystem );
-
-    // ReSharper disable once CppExpressionWithoutSideEffects
-    editor_validator_subsystem->ValidateAssets( asset_data_list );
-
-    return true;
-}
+#include "NamingConventionValidationCommandlet.h"
+
+#include "NamingConventionValidationLog.h"
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationBaseline.h"
+#include "NamingConventionValidationSettings.h"
+
+#include <Editor.h>
+#include <AssetRegistryHelpers.h>
+#include <AssetRegistryModule.h>
+#include <IAssetRegistry.h>
+
+UNamingConventionValidationCommandlet::UNamingConventionValidationCommandlet()
+{
+    LogToConsole = false;
+}
+
+int32 UNamingConventionValidationCommandlet::Main( const FString & params )
+{
+    UE_LOG( LogNamingConventionValidation, Log, TEXT( "--------------------------------------------------------------------------------------------" ) );
+    UE_LOG( LogNamingConventionValidation, Log, TEXT( "Running NamingConventionValidation Commandlet" ) );
+    TArray< FString > tokens;
+    TArray< FString > switches;
+    TMap< FString, FString > params_map;
+    ParseCommandLine( *params, tokens, switches, params_map );
+
+    const auto check_name_collisions = switches.Contains( TEXT( "NameCollisions" ) );
+    const auto baseline_path = params_map.FindRef( TEXT( "Baseline" ) );
+    const auto write_baseline_path = params_map.FindRef( TEXT( "WriteBaseline" ) );
+
+    // validate data
+    if ( !ValidateData( check_name_collisions, baseline_path, write_baseline_path, true ) )
+    {
+        UE_LOG( LogNamingConventionValidation, Warning, TEXT( "Errors occurred while validating naming convention" ) );
+        return 2; // return something other than 1 for error since the engine will return 1 if any other system (possibly unrelated) logged errors during execution.
+    }
+
+    UE_LOG( LogNamingConventionValidation, Log, TEXT( "Successfully finished running NamingConventionValidation Commandlet" ) );
+    UE_LOG( LogNamingConventionValidation, Log, TEXT( "--------------------------------------------------------------------------------------------" ) );
+    return 0;
+}
+
+//static
+bool UNamingConventionValidationCommandlet::ValidateData( const bool check_name_collisions, const FString & baseline_path, const FString & write_baseline_path, const bool does_fail_on_name_collisions )
+{
+    auto * editor_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
+    check( editor_validator_subsystem );
+
+    TArray< FAssetData > asset_data_list;
+    editor_validator_subsystem->GetAssetsToValidate( asset_data_list, { TEXT( "/Game" ) } );
+
+    const auto uses_baseline = !baseline_path.IsEmpty();
+    FNamingConventionValidationBaseline baseline;
+
+    if ( uses_baseline )
+    {
+        if ( !baseline.LoadFromFile( baseline_path ) )
+        {
+            UE_LOG( LogNamingConventionValidation, Error, TEXT( "Impossible to load the baseline %s" ), *baseline_path );
+            return false;
+        }
+
+        UE_LOG( LogNamingConventionValidation, Log, TEXT( "Loaded %d known violations from the baseline %s" ), baseline.GetNumEntries(), *baseline_path );
+    }
+
+    const auto records_violations = uses_baseline || !write_baseline_path.IsEmpty();
+    const auto num_new_violations = editor_validator_subsystem->ValidateAssets( asset_data_list, true, true, records_violations ? &baseline : nullptr );
+
+    if ( uses_baseline )
+    {
+        TArray< FNamingConventionValidationBaselineEntry > stale_entries;
+        baseline.GetStaleEntries( stale_entries );
+
+        for ( const auto & stale_entry : stale_entries )
+        {
+            UE_LOG( LogNamingConventionValidation, Warning, TEXT( "Stale baseline entry: %s no longer violates %s" ), *stale_entry.PackageName.ToString(), *stale_entry.RuleName.ToString() );
+        }
+
+        UE_LOG( LogNamingConventionValidation, Log, TEXT( "%d new violations, %d stale baseline entries" ), num_new_violations, stale_entries.Num() );
+    }
+
+    if ( !write_baseline_path.IsEmpty() )
+    {
+        if ( baseline.SaveViolationsToFile( write_baseline_path ) )
+        {
+            UE_LOG( LogNamingConventionValidation, Log, TEXT( "Baseline written to %s" ), *write_baseline_path );
+        }
+        else
+        {
+            UE_LOG( LogNamingConventionValidation, Error, TEXT( "Impossible to write the baseline %s" ), *write_baseline_path );
+        }
+    }
+
+    auto num_name_collision_groups = 0;
+
+    if ( check_name_collisions || GetDefault< UNamingConventionValidationSettings >()->DoesValidateNameCollisions )
+    {
+        num_name_collision_groups = editor_validator_subsystem->ValidateAssetNameCollisions( asset_data_list );
+    }
+
+    // Without a baseline, the violations are only reported, to not break the existing pipelines.
+    // The name collisions check is opt-in, so the commandlet fails on them. The editor menu only reports them in the log
+    return ( !uses_baseline || num_new_violations == 0 ) && ( !does_fail_on_name_collisions || num_name_collision_groups == 0 );
+}
@@ -1,3 +1,3 @@
-#include "NamingConventionValidationLog.h"
-
+#include "NamingConventionValidationLog.h"
+
 DEFINE_LOG_CATEGORY( LogNamingConventionValidation );
\ No newline at end of file
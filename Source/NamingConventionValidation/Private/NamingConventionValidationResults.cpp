@@ -0,0 +1,43 @@
+#include "NamingConventionValidationResults.h"
+
+#include <AssetData.h>
+
+FNamingConventionValidationResults::FNamingConventionValidationResults( const FText & title, const bool list_excluded_assets ) :
+    Title( title ),
+    NumExcludedAssets( 0 ),
+    ListExcludedAssets( list_excluded_assets )
+{
+}
+
+void FNamingConventionValidationResults::AddResult( const FAssetData & asset_data, const ENamingConventionValidationResult result, const FName rule_name, const FText & error_message )
+{
+    switch ( result )
+    {
+        case ENamingConventionValidationResult::Valid:
+        {
+            return;
+        }
+        case ENamingConventionValidationResult::Excluded:
+        {
+            ++NumExcludedAssets;
+            ++NumExcludedAssetsPerRule.FindOrAdd( rule_name, 0 );
+
+            if ( !ListExcludedAssets )
+            {
+                return;
+            }
+        }
+        break;
+        default:
+        {
+        }
+        break;
+    }
+
+    auto & record = Records.AddDefaulted_GetRef();
+    record.PackageName = asset_data.PackageName;
+    record.AssetClass = asset_data.AssetClass;
+    record.RuleName = rule_name;
+    record.Message = error_message;
+    record.Result = result;
+}
@@ -0,0 +1,488 @@
+#include "NamingConventionValidationRuleSet.h"
+
+#include "NamingConventionValidationLog.h"
+#include "NamingConventionValidationSettings.h"
+
+#include <Misc/PackageName.h>
+
+bool FNamingConventionValidationCompiledFolderRule::IsClassAllowed( const UClass * asset_class ) const
+{
+    if ( AllowedClassPaths.Num() == 0 )
+    {
+        return true;
+    }
+
+    for ( const auto & allowed_class : AllowedClasses )
+    {
+        const auto * resolved_class = allowed_class.Get();
+        if ( resolved_class != nullptr && asset_class->IsChildOf( resolved_class ) )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+FNamingConventionValidationCompiledNameLint::FNamingConventionValidationCompiledNameLint() :
+    MaxLength( 0 )
+{
+    DoesRequirePascalCaseSegments = false;
+    DoesForbidDoubleUnderscores = false;
+    FMemory::Memzero( CharacterClasses );
+}
+
+void FNamingConventionValidationCompiledNameLint::Compile()
+{
+    FMemory::Memzero( CharacterClasses );
+
+    for ( TCHAR character = 0; character < UE_ARRAY_COUNT( CharacterClasses ); ++character )
+    {
+        auto & character_class = CharacterClasses[ character ];
+
+        if ( FChar::IsUpper( character ) )
+        {
+            character_class |= Uppercase;
+        }
+        else if ( FChar::IsLower( character ) )
+        {
+            character_class |= Lowercase;
+        }
+        else if ( FChar::IsDigit( character ) )
+        {
+            character_class |= Digit;
+        }
+        else if ( character == TEXT( '_' ) )
+        {
+            character_class |= Underscore;
+        }
+
+        if ( AllowedCharacters.IsEmpty() )
+        {
+            character_class |= Allowed;
+        }
+    }
+
+    const auto num_allowed_characters = AllowedCharacters.Len();
+
+    for ( auto index = 0; index < num_allowed_characters; ++index )
+    {
+        const auto first_character = AllowedCharacters[ index ];
+        auto last_character = first_character;
+
+        if ( index + 2 < num_allowed_characters && AllowedCharacters[ index + 1 ] == TEXT( '-' ) )
+        {
+            last_character = AllowedCharacters[ index + 2 ];
+            index += 2;
+        }
+
+        for ( int32 character = first_character; character <= last_character && character < UE_ARRAY_COUNT( CharacterClasses ); ++character )
+        {
+            CharacterClasses[ character ] |= Allowed;
+        }
+    }
+}
+
+ENamingConventionValidationNameLintResult FNamingConventionValidationCompiledNameLint::Lint( const TCHAR * name, const int32 length, int32 & error_index ) const
+{
+    if ( MaxLength > 0 && length > MaxLength )
+    {
+        error_index = MaxLength;
+        return ENamingConventionValidationNameLintResult::TooLong;
+    }
+
+    // Non ASCII characters are only allowed when there is no restriction on the characters
+    const uint8 unknown_character_class = AllowedCharacters.IsEmpty() ? Allowed : 0;
+    uint8 previous_character_class = 0;
+    auto is_segment_start = true;
+
+    for ( auto index = 0; index < length; ++index )
+    {
+        const auto character = name[ index ];
+        const auto character_class = static_cast< uint32 >( character ) < UE_ARRAY_COUNT( CharacterClasses ) ? CharacterClasses[ character ] : unknown_character_class;
+
+        if ( ( character_class & Allowed ) == 0 )
+        {
+            error_index = index;
+            return ENamingConventionValidationNameLintResult::ForbiddenCharacter;
+        }
+
+        if ( DoesForbidDoubleUnderscores && ( character_class & previous_character_class & Underscore ) != 0 )
+        {
+            error_index = index;
+            return ENamingConventionValidationNameLintResult::DoubleUnderscore;
+        }
+
+        if ( DoesRequirePascalCaseSegments && is_segment_start && ( character_class & ( Uppercase | Digit | Underscore ) ) == 0 )
+        {
+            error_index = index;
+            return ENamingConventionValidationNameLintResult::NotPascalCase;
+        }
+
+        is_segment_start = ( character_class & Underscore ) != 0;
+        previous_character_class = character_class;
+    }
+
+    return ENamingConventionValidationNameLintResult::Valid;
+}
+
+bool FNamingConventionValidationRuleSetChanges::IsPackageAffected( const FString & package_name ) const
+{
+    if ( AreAllAssetsAffected )
+    {
+        return true;
+    }
+
+    for ( const auto & path_prefix : ChangedPathPrefixes )
+    {
+        if ( package_name.StartsWith( path_prefix ) )
+        {
+            return true;
+        }
+    }
+
+    if ( ChangedPathPatterns.Num() > 0 )
+    {
+        const auto package_path = FPackageName::GetLongPackagePath( package_name );
+
+        for ( const auto & path_pattern : ChangedPathPatterns )
+        {
+            if ( package_path.MatchesWildcard( path_pattern ) )
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+FNamingConventionValidationRuleSet::FNamingConventionValidationRuleSet() :
+    Version( 0 )
+{
+    LogWarningWhenNoClassDescriptionForAsset = false;
+    AllowValidationInDevelopersFolder = false;
+    AllowValidationOnlyInGameFolder = true;
+    DoesValidateFolderNames = false;
+}
+
+TSharedRef< FNamingConventionValidationRuleSet, ESPMode::ThreadSafe > FNamingConventionValidationRuleSet::CreateFromSettings( const UNamingConventionValidationSettings & settings, const uint32 version )
+{
+    check( IsInGameThread() );
+
+    auto rule_set = MakeShared< FNamingConventionValidationRuleSet, ESPMode::ThreadSafe >();
+    rule_set->Version = version;
+    rule_set->BlueprintsPrefix = settings.BlueprintsPrefix;
+    rule_set->LogWarningWhenNoClassDescriptionForAsset = settings.LogWarningWhenNoClassDescriptionForAsset;
+    rule_set->AllowValidationInDevelopersFolder = settings.AllowValidationInDevelopersFolder;
+    rule_set->AllowValidationOnlyInGameFolder = settings.AllowValidationOnlyInGameFolder;
+    rule_set->DoesValidateFolderNames = settings.DoesValidateFolderNames;
+
+    rule_set->NameLint.AllowedCharacters = settings.NameLintRules.AllowedCharacters;
+    rule_set->NameLint.MaxLength = settings.NameLintRules.MaxLength;
+    rule_set->NameLint.DoesRequirePascalCaseSegments = settings.NameLintRules.DoesRequirePascalCaseSegments;
+    rule_set->NameLint.DoesForbidDoubleUnderscores = settings.NameLintRules.DoesForbidDoubleUnderscores;
+
+    for ( const auto & directory : settings.ExcludedDirectories )
+    {
+        rule_set->ExcludedDirectories.Add( directory.Path );
+    }
+
+    rule_set->ClassDescriptions.Reserve( settings.ClassDescriptions.Num() );
+
+    for ( const auto & class_description : settings.ClassDescriptions )
+    {
+        auto & compiled_description = rule_set->ClassDescriptions.AddDefaulted_GetRef();
+        compiled_description.ClassPath = class_description.ClassPath.ToString();
+        compiled_description.Prefix = class_description.Prefix;
+        compiled_description.Suffix = class_description.Suffix;
+        compiled_description.Priority = class_description.Priority;
+    }
+
+    for ( const auto & class_path : settings.ExcludedClassPaths )
+    {
+        rule_set->ExcludedClassPaths.Add( class_path.ToString() );
+    }
+
+    rule_set->FolderRules.Reserve( settings.FolderRules.Num() );
+
+    for ( const auto & folder_rule : settings.FolderRules )
+    {
+        auto & compiled_folder_rule = rule_set->FolderRules.AddDefaulted_GetRef();
+        compiled_folder_rule.PathPattern = folder_rule.PathPattern;
+        compiled_folder_rule.RequiredKeyword = folder_rule.RequiredKeyword;
+
+        for ( const auto & allowed_class : folder_rule.AllowedClasses )
+        {
+            compiled_folder_rule.AllowedClassPaths.Add( allowed_class.ToString() );
+        }
+    }
+
+    rule_set->ResolveClasses();
+
+    return rule_set;
+}
+
+void FNamingConventionValidationRuleSet::Compile()
+{
+    // Stable, so descriptions sharing the same priority keep the order in which they are declared in the settings
+    ClassDescriptions.StableSort();
+
+    static const FString EngineDirectoryPath( TEXT( "/Engine/" ) );
+
+    ExcludedDirectories.RemoveAll( []( const FString & path ) {
+        return path.IsEmpty();
+    } );
+    ExcludedDirectories.AddUnique( EngineDirectoryPath );
+
+    NameLint.Compile();
+    InitializeRuleNames();
+}
+
+void FNamingConventionValidationRuleSet::InitializeRuleNames()
+{
+    // Rule names identify what decided the result of an asset, for example in baselines. They only depend on what the rules apply to,
+    // so editing the prefix of a class description keeps the same rule name
+    for ( auto & class_description : ClassDescriptions )
+    {
+        class_description.RuleName = FName( *FString::Printf( TEXT( "ClassDescription:%s" ), *class_description.ClassPath ) );
+    }
+
+    for ( auto & folder_rule : FolderRules )
+    {
+        folder_rule.RuleName = FName( *FString::Printf( TEXT( "FolderRule:%s" ), *folder_rule.PathPattern ) );
+    }
+
+    ExcludedDirectoryRuleNames.Reset( ExcludedDirectories.Num() );
+
+    for ( const auto & excluded_directory : ExcludedDirectories )
+    {
+        ExcludedDirectoryRuleNames.Add( FName( *FString::Printf( TEXT( "ExcludedDirectory:%s" ), *excluded_directory ) ) );
+    }
+}
+
+void FNamingConventionValidationRuleSet::ResolveClasses()
+{
+    check( IsInGameThread() );
+
+    // Descriptions whose class can not be found are kept, but never match any asset
+    for ( auto & class_description : ClassDescriptions )
+    {
+        class_description.Class = TSoftClassPtr< UObject >( FSoftObjectPath( class_description.ClassPath ) ).LoadSynchronous();
+
+        UE_CLOG( !class_description.Class.IsValid(), LogNamingConventionValidation, Warning, TEXT( "Impossible to get a valid UClass for the classpath %s" ), *class_description.ClassPath );
+    }
+
+    for ( auto & folder_rule : FolderRules )
+    {
+        folder_rule.AllowedClasses.Reset( folder_rule.AllowedClassPaths.Num() );
+
+        for ( const auto & class_path : folder_rule.AllowedClassPaths )
+        {
+            auto * allowed_class = TSoftClassPtr< UObject >( FSoftObjectPath( class_path ) ).LoadSynchronous();
+            UE_CLOG( allowed_class == nullptr, LogNamingConventionValidation, Warning, TEXT( "Impossible to get a valid UClass for the classpath %s allowed in %s" ), *class_path, *folder_rule.PathPattern );
+
+            folder_rule.AllowedClasses.Add( allowed_class );
+        }
+    }
+
+    ExcludedClasses.Reset( ExcludedClassPaths.Num() );
+    ExcludedClassRuleNames.Reset( ExcludedClassPaths.Num() );
+
+    for ( const auto & class_path : ExcludedClassPaths )
+    {
+        auto * excluded_class = TSoftClassPtr< UObject >( FSoftObjectPath( class_path ) ).LoadSynchronous();
+        UE_CLOG( excluded_class == nullptr, LogNamingConventionValidation, Warning, TEXT( "Impossible to get a valid UClass for the excluded classpath %s" ), *class_path );
+
+        if ( excluded_class != nullptr )
+        {
+            ExcludedClasses.Add( excluded_class );
+            ExcludedClassRuleNames.Add( FName( *FString::Printf( TEXT( "ExcludedClass:%s" ), *class_path ) ) );
+        }
+    }
+}
+
+void FNamingConventionValidationRuleSet::FindChanges( const FNamingConventionValidationRuleSet & old_rule_set, const FNamingConventionValidationRuleSet & new_rule_set, FNamingConventionValidationRuleSetChanges & changes )
+{
+    static const FName BlueprintRuleName( "BlueprintsPrefix" );
+    static const FString DevelopersDirectoryPath( TEXT( "/Game/Developers/" ) );
+
+    const auto & old_name_lint = old_rule_set.NameLint;
+    const auto & new_name_lint = new_rule_set.NameLint;
+
+    // These rules are checked for all the assets, before the rules which can be tracked
+    if ( old_name_lint.AllowedCharacters != new_name_lint.AllowedCharacters
+         || old_name_lint.MaxLength != new_name_lint.MaxLength
+         || old_name_lint.DoesRequirePascalCaseSegments != new_name_lint.DoesRequirePascalCaseSegments
+         || old_name_lint.DoesForbidDoubleUnderscores != new_name_lint.DoesForbidDoubleUnderscores
+         || old_rule_set.DoesValidateFolderNames != new_rule_set.DoesValidateFolderNames
+         || old_rule_set.AllowValidationOnlyInGameFolder != new_rule_set.AllowValidationOnlyInGameFolder
+         || old_rule_set.ExcludedClassPaths != new_rule_set.ExcludedClassPaths )
+    {
+        changes.AreAllAssetsAffected = true;
+        return;
+    }
+
+    if ( old_rule_set.AllowValidationInDevelopersFolder != new_rule_set.AllowValidationInDevelopersFolder )
+    {
+        changes.ChangedPathPrefixes.Add( DevelopersDirectoryPath );
+    }
+
+    // The assets of a removed directory were all decided by its rule, but the assets of an added directory could have been decided by any rule
+    for ( auto index = 0; index < old_rule_set.ExcludedDirectories.Num(); ++index )
+    {
+        if ( !new_rule_set.ExcludedDirectories.Contains( old_rule_set.ExcludedDirectories[ index ] ) )
+        {
+            changes.ChangedRuleNames.Add( old_rule_set.ExcludedDirectoryRuleNames[ index ] );
+        }
+    }
+
+    for ( const auto & excluded_directory : new_rule_set.ExcludedDirectories )
+    {
+        if ( !old_rule_set.ExcludedDirectories.Contains( excluded_directory ) )
+        {
+            changes.ChangedPathPrefixes.Add( excluded_directory );
+        }
+    }
+
+    if ( old_rule_set.BlueprintsPrefix != new_rule_set.BlueprintsPrefix )
+    {
+        changes.ChangedRuleNames.Add( BlueprintRuleName );
+    }
+
+    const auto & old_class_descriptions = old_rule_set.ClassDescriptions;
+    const auto & new_class_descriptions = new_rule_set.ClassDescriptions;
+    auto are_class_descriptions_reordered = old_class_descriptions.Num() != new_class_descriptions.Num();
+
+    for ( auto index = 0; index < old_class_descriptions.Num() && !are_class_descriptions_reordered; ++index )
+    {
+        are_class_descriptions_reordered = old_class_descriptions[ index ].ClassPath != new_class_descriptions[ index ].ClassPath;
+    }
+
+    if ( are_class_descriptions_reordered )
+    {
+        // The assets can now be decided by another description, and the assets which were not decided by any can now be
+        for ( const auto & class_description : old_class_descriptions )
+        {
+            changes.ChangedRuleNames.Add( class_description.RuleName );
+        }
+
+        changes.ChangedRuleNames.Add( BlueprintRuleName );
+        changes.ChangedRuleNames.Add( NAME_None );
+    }
+    else
+    {
+        for ( auto index = 0; index < old_class_descriptions.Num(); ++index )
+        {
+            if ( old_class_descriptions[ index ].Prefix != new_class_descriptions[ index ].Prefix
+                 || old_class_descriptions[ index ].Suffix != new_class_descriptions[ index ].Suffix )
+            {
+                changes.ChangedRuleNames.Add( old_class_descriptions[ index ].RuleName );
+            }
+        }
+    }
+
+    const auto num_folder_rules = FMath::Max( old_rule_set.FolderRules.Num(), new_rule_set.FolderRules.Num() );
+
+    for ( auto index = 0; index < num_folder_rules; ++index )
+    {
+        const auto * old_folder_rule = old_rule_set.FolderRules.IsValidIndex( index ) ? &old_rule_set.FolderRules[ index ] : nullptr;
+        const auto * new_folder_rule = new_rule_set.FolderRules.IsValidIndex( index ) ? &new_rule_set.FolderRules[ index ] : nullptr;
+
+        if ( old_folder_rule != nullptr && new_folder_rule != nullptr
+             && old_folder_rule->PathPattern == new_folder_rule->PathPattern
+             && old_folder_rule->RequiredKeyword == new_folder_rule->RequiredKeyword
+             && old_folder_rule->AllowedClassPaths == new_folder_rule->AllowedClassPaths )
+        {
+            continue;
+        }
+
+        if ( old_folder_rule != nullptr )
+        {
+            changes.ChangedPathPatterns.AddUnique( old_folder_rule->PathPattern );
+        }
+
+        if ( new_folder_rule != nullptr )
+        {
+            changes.ChangedPathPatterns.AddUnique( new_folder_rule->PathPattern );
+        }
+    }
+}
+
+bool FNamingConventionValidationRuleSet::IsExternalPackagePath( const FString & path )
+{
+    return path.Contains( TEXT( "/__ExternalActors__" ), ESearchCase::CaseSensitive )
+           || path.Contains( TEXT( "/__ExternalObjects__" ), ESearchCase::CaseSensitive );
+}
+
+bool FNamingConventionValidationRuleSet::IsPathExcludedFromValidation( const FString & path ) const
+{
+    return !FindPathExclusionRule( path ).IsNone();
+}
+
+FName FNamingConventionValidationRuleSet::FindPathExclusionRule( const FString & path ) const
+{
+    static const FName
+        OutsideGameFolderRuleName( "ExcludedPath:OutsideGameFolder" ),
+        DevelopersFolderRuleName( "ExcludedPath:DevelopersFolder" );
+
+    if ( !path.StartsWith( "/Game/" ) && AllowValidationOnlyInGameFolder )
+    {
+        return OutsideGameFolderRuleName;
+    }
+
+    if ( path.StartsWith( "/Game/Developers/" ) && !AllowValidationInDevelopersFolder )
+    {
+        return DevelopersFolderRuleName;
+    }
+
+    for ( auto index = 0; index < ExcludedDirectories.Num(); ++index )
+    {
+        if ( path.StartsWith( ExcludedDirectories[ index ] ) )
+        {
+            return ExcludedDirectoryRuleNames[ index ];
+        }
+    }
+
+    return NAME_None;
+}
+
+const UClass * FNamingConventionValidationRuleSet::FindExcludedClass( const UClass * asset_class, FName & rule_name ) const
+{
+    for ( auto index = 0; index < ExcludedClasses.Num(); ++index )
+    {
+        const auto * resolved_class = ExcludedClasses[ index ].Get();
+        if ( resolved_class != nullptr && asset_class->IsChildOf( resolved_class ) )
+        {
+            rule_name = ExcludedClassRuleNames[ index ];
+            return resolved_class;
+        }
+    }
+
+    return nullptr;
+}
+
+const FNamingConventionValidationCompiledClassDescription * FNamingConventionValidationRuleSet::FindClassDescription( const UClass * asset_class ) const
+{
+    for ( const auto & class_description : ClassDescriptions )
+    {
+        const auto * description_class = class_description.Class.Get();
+        if ( description_class != nullptr && asset_class->IsChildOf( description_class ) )
+        {
+            return &class_description;
+        }
+    }
+
+    return nullptr;
+}
+
+void FNamingConventionValidationRuleSet::FindFolderRules( const FString & package_path, TArray< int32 > & folder_rule_indices ) const
+{
+    for ( auto index = 0; index < FolderRules.Num(); ++index )
+    {
+        if ( package_path.MatchesWildcard( FolderRules[ index ].PathPattern ) )
+        {
+            folder_rule_indices.Add( index );
+        }
+    }
+}
@@ -0,0 +1,420 @@
+#include "NamingConventionValidationServerCommandlet.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationLog.h"
+
+#include <AssetRegistryModule.h>
+#include <Async/TaskGraphInterfaces.h>
+#include <Common/TcpSocketBuilder.h>
+#include <Containers/Ticker.h>
+#include <DirectoryWatcherModule.h>
+#include <Editor.h>
+#include <IDirectoryWatcher.h>
+#include <Interfaces/IPluginManager.h>
+#include <Misc/PackageName.h>
+#include <Misc/Paths.h>
+#include <SocketSubsystem.h>
+#include <Sockets.h>
+
+const int32 UNamingConventionValidationServerCommandlet::DefaultPort = 23950;
+
+static const double RequestTimeoutSeconds = 5.0;
+static const double ResponseTimeoutSeconds = 5.0;
+
+// Number of modified files scanned again by the asset registry each time the server has no request to handle
+static const int32 NumFilesToRescanWhenIdle = 16;
+
+// The assets loaded to find their class are released once no request has been received for this long, so a burst of requests does not wait for the garbage collections
+static const double GarbageCollectionIdleDelaySeconds = 2.0;
+
+UNamingConventionValidationServerCommandlet::UNamingConventionValidationServerCommandlet()
+{
+    LogToConsole = false;
+    IsStopRequested = false;
+}
+
+int32 UNamingConventionValidationServerCommandlet::Main( const FString & params )
+{
+    auto port = DefaultPort;
+    FParse::Value( *params, TEXT( "Port=" ), port );
+
+    auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) ).Get();
+
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "Gathering the assets of the project..." ) );
+    asset_registry.SearchAllAssets( true );
+
+    auto * socket_subsystem = ISocketSubsystem::Get( PLATFORM_SOCKETSUBSYSTEM );
+    auto * listen_socket = FTcpSocketBuilder( TEXT( "NamingConventionValidationServer" ) )
+                               .AsNonBlocking()
+                               .AsReusable()
+                               .BoundToAddress( FIPv4Address( 127, 0, 0, 1 ) )
+                               .BoundToPort( port )
+                               .Listening( 8 )
+                               .Build();
+
+    if ( listen_socket == nullptr )
+    {
+        UE_LOG( LogNamingConventionValidation, Error, TEXT( "Impossible to listen on port %d" ), port );
+        return 1;
+    }
+
+    // The asset registry only watches the content directories by itself when running the editor
+    auto * directory_watcher = FModuleManager::LoadModuleChecked< FDirectoryWatcherModule >( TEXT( "DirectoryWatcher" ) ).Get();
+    TArray< FString > content_directories;
+    TArray< FDelegateHandle > directory_changed_delegate_handles;
+
+    content_directories.Add( FPaths::ConvertRelativePathToFull( FPaths::ProjectContentDir() ) );
+
+    for ( const auto & plugin : IPluginManager::Get().GetEnabledPluginsWithContent() )
+    {
+        const auto plugin_content_directory = FPaths::ConvertRelativePathToFull( plugin->GetContentDir() );
+
+        if ( FPaths::DirectoryExists( plugin_content_directory ) )
+        {
+            content_directories.Add( plugin_content_directory );
+        }
+    }
+
+    if ( directory_watcher != nullptr )
+    {
+        for ( const auto & content_directory : content_directories )
+        {
+            directory_watcher->RegisterDirectoryChangedCallback_Handle(
+                content_directory,
+                IDirectoryWatcher::FDirectoryChanged::CreateUObject( this, &UNamingConventionValidationServerCommandlet::OnContentDirectoryChanged ),
+                directory_changed_delegate_handles.AddDefaulted_GetRef() );
+        }
+    }
+
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "Naming convention validation server listening on 127.0.0.1:%d" ), port );
+
+    auto last_time = FPlatformTime::Seconds();
+    auto last_request_time = last_time;
+    auto is_garbage_collection_pending = false;
+
+    while ( !IsStopRequested && !IsEngineExitRequested() )
+    {
+        const auto current_time = FPlatformTime::Seconds();
+        const auto delta_time = static_cast< float >( current_time - last_time );
+        last_time = current_time;
+
+        if ( directory_watcher != nullptr )
+        {
+            directory_watcher->Tick( delta_time );
+        }
+
+        asset_registry.Tick( delta_time );
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle( ENamedThreads::GameThread );
+        FTicker::GetCoreTicker().Tick( delta_time );
+
+        auto has_pending_connection = false;
+        if ( listen_socket->HasPendingConnection( has_pending_connection ) && has_pending_connection )
+        {
+            if ( auto * client_socket = listen_socket->Accept( TEXT( "NamingConventionValidationClient" ) ) )
+            {
+                HandleClient( *client_socket );
+                client_socket->Close();
+                socket_subsystem->DestroySocket( client_socket );
+
+                last_request_time = FPlatformTime::Seconds();
+                is_garbage_collection_pending = true;
+            }
+        }
+        else
+        {
+            // Keep the registry up to date while nobody is waiting, so the next requests do not pay for it
+            RescanDirtyFiles( NumFilesToRescanWhenIdle );
+
+            // Nothing else unloads the assets in a commandlet, so the memory would keep growing with each request
+            if ( is_garbage_collection_pending && current_time - last_request_time >= GarbageCollectionIdleDelaySeconds )
+            {
+                CollectGarbage( RF_NoFlags );
+                is_garbage_collection_pending = false;
+            }
+
+            FPlatformProcess::Sleep( 0.01f );
+        }
+    }
+
+    if ( directory_watcher != nullptr )
+    {
+        for ( auto directory_index = 0; directory_index < content_directories.Num(); ++directory_index )
+        {
+            directory_watcher->UnregisterDirectoryChangedCallback_Handle( content_directories[ directory_index ], directory_changed_delegate_handles[ directory_index ] );
+        }
+    }
+
+    listen_socket->Close();
+    socket_subsystem->DestroySocket( listen_socket );
+
+    UE_LOG( LogNamingConventionValidation, Display, TEXT( "Naming convention validation server stopped" ) );
+    return 0;
+}
+
+void UNamingConventionValidationServerCommandlet::OnContentDirectoryChanged( const TArray< FFileChangeData > & file_changes )
+{
+    for ( const auto & file_change : file_changes )
+    {
+        if ( FPackageName::IsPackageExtension( *FPaths::GetExtension( file_change.Filename, true ) ) )
+        {
+            auto file_name = FPaths::ConvertRelativePathToFull( file_change.Filename );
+            FPaths::NormalizeFilename( file_name );
+            DirtyFileNames.Add( MoveTemp( file_name ) );
+        }
+    }
+}
+
+void UNamingConventionValidationServerCommandlet::RescanDirtyFiles( const int32 max_num_files )
+{
+    if ( DirtyFileNames.Num() == 0 )
+    {
+        return;
+    }
+
+    TArray< FString > file_names;
+
+    for ( auto iterator = DirtyFileNames.CreateIterator(); iterator && file_names.Num() < max_num_files; ++iterator )
+    {
+        // The registry keeps the assets of the deleted files, they are filtered out when validating
+        if ( FPaths::FileExists( *iterator ) )
+        {
+            file_names.Add( *iterator );
+        }
+
+        iterator.RemoveCurrent();
+    }
+
+    if ( file_names.Num() > 0 )
+    {
+        FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) ).Get().ScanFilesSynchronous( file_names, true );
+    }
+}
+
+void UNamingConventionValidationServerCommandlet::HandleClient( FSocket & client_socket )
+{
+    TArray< FString > lines;
+
+    if ( !ReceiveRequest( client_socket, lines ) )
+    {
+        UE_LOG( LogNamingConventionValidation, Warning, TEXT( "Incomplete naming convention validation request ignored" ) );
+        return;
+    }
+
+    if ( lines.Num() == 1 && lines[ 0 ] == TEXT( "QUIT" ) )
+    {
+        IsStopRequested = true;
+        SendResponse( client_socket, TEXT( "END\t0\n" ) );
+        return;
+    }
+
+    const auto start_time = FPlatformTime::Seconds();
+
+    FString response;
+    ValidateFiles( lines, response );
+
+    if ( !SendResponse( client_socket, response ) )
+    {
+        UE_LOG( LogNamingConventionValidation, Warning, TEXT( "Impossible to send the naming convention validation response" ) );
+    }
+
+    UE_LOG( LogNamingConventionValidation, Log, TEXT( "Validated %d paths in %.2f ms" ), lines.Num(), ( FPlatformTime::Seconds() - start_time ) * 1000.0 );
+}
+
+bool UNamingConventionValidationServerCommandlet::ReceiveRequest( FSocket & client_socket, TArray< FString > & lines ) const
+{
+    TArray< uint8 > buffer;
+    auto is_complete = false;
+    const auto end_time = FPlatformTime::Seconds() + RequestTimeoutSeconds;
+
+    while ( !is_complete && FPlatformTime::Seconds() < end_time )
+    {
+        if ( !client_socket.Wait( ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds( 100.0 ) ) )
+        {
+            continue;
+        }
+
+        uint8 chunk[ 4096 ];
+        auto num_bytes_read = 0;
+
+        // Nothing to read from a readable socket means the client closed its side of the connection
+        if ( !client_socket.Recv( chunk, sizeof( chunk ), num_bytes_read ) || num_bytes_read == 0 )
+        {
+            is_complete = buffer.Num() > 0;
+            break;
+        }
+
+        buffer.Append( chunk, num_bytes_read );
+
+        // The request ends with an empty line
+        const auto num_bytes = buffer.Num();
+        is_complete = ( num_bytes >= 2 && buffer[ num_bytes - 1 ] == '\n' && buffer[ num_bytes - 2 ] == '\n' )
+                      || ( num_bytes >= 4 && FMemory::Memcmp( buffer.GetData() + num_bytes - 4, "\r\n\r\n", 4 ) == 0 );
+    }
+
+    if ( !is_complete )
+    {
+        return false;
+    }
+
+    const FUTF8ToTCHAR converter( reinterpret_cast< const ANSICHAR * >( buffer.GetData() ), buffer.Num() );
+    const FString request( converter.Length(), converter.Get() );
+
+    request.ParseIntoArrayLines( lines, true );
+
+    for ( auto & line : lines )
+    {
+        line.TrimStartAndEndInline();
+    }
+
+    lines.RemoveAll( []( const FString & line ) {
+        return line.IsEmpty();
+    } );
+
+    return lines.Num() > 0;
+}
+
+bool UNamingConventionValidationServerCommandlet::SendResponse( FSocket & client_socket, const FString & response ) const
+{
+    const FTCHARToUTF8 converter( *response );
+    const auto * data = reinterpret_cast< const uint8 * >( converter.Get() );
+    const auto num_bytes = converter.Length();
+    const auto end_time = FPlatformTime::Seconds() + ResponseTimeoutSeconds;
+    auto num_bytes_sent = 0;
+
+    while ( num_bytes_sent < num_bytes )
+    {
+        auto num_bytes_sent_this_time = 0;
+
+        if ( !client_socket.Send( data + num_bytes_sent, num_bytes - num_bytes_sent, num_bytes_sent_this_time ) )
+        {
+            // The accepted socket is non-blocking like the listening one: wait until the client reads what was already sent
+            if ( ISocketSubsystem::Get( PLATFORM_SOCKETSUBSYSTEM )->GetLastErrorCode() != SE_EWOULDBLOCK )
+            {
+                return false;
+            }
+
+            num_bytes_sent_this_time = 0;
+        }
+
+        num_bytes_sent += num_bytes_sent_this_time;
+
+        if ( num_bytes_sent_this_time == 0 )
+        {
+            if ( FPlatformTime::Seconds() >= end_time )
+            {
+                return false;
+            }
+
+            client_socket.Wait( ESocketWaitConditions::WaitForWrite, FTimespan::FromMilliseconds( 100.0 ) );
+        }
+    }
+
+    return true;
+}
+
+void UNamingConventionValidationServerCommandlet::ValidateFiles( const TArray< FString > & paths, FString & response )
+{
+    auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) ).Get();
+    const auto * naming_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >();
+    const auto * result_enum = StaticEnum< ENamingConventionValidationResult >();
+
+    // Keep the same rule set for the whole request
+    const FNamingConventionValidationContext context( naming_validator_subsystem->GetRuleSet() );
+
+    TArray< FString > package_names;
+    TArray< FString > file_names;
+    TArray< FString > file_names_to_rescan;
+    package_names.Reserve( paths.Num() );
+    file_names.Reserve( paths.Num() );
+
+    for ( const auto & path : paths )
+    {
+        FString package_name;
+        FString file_name;
+
+        if ( FPackageName::IsValidLongPackageName( path, true ) )
+        {
+            package_name = path;
+            FPackageName::DoesPackageExist( package_name, nullptr, &file_name );
+            file_name = FPaths::ConvertRelativePathToFull( file_name );
+        }
+        else
+        {
+            file_name = FPaths::IsRelative( path ) ? FPaths::ConvertRelativePathToFull( FPaths::ProjectDir(), path ) : path;
+            FPackageName::TryConvertFilenameToLongPackageName( file_name, package_name );
+        }
+
+        FPaths::NormalizeFilename( file_name );
+
+        // Scan all the modified files of the request at once
+        if ( DirtyFileNames.Remove( file_name ) > 0 && FPaths::FileExists( file_name ) )
+        {
+            file_names_to_rescan.Add( file_name );
+        }
+
+        package_names.Emplace( MoveTemp( package_name ) );
+        file_names.Emplace( MoveTemp( file_name ) );
+    }
+
+    if ( file_names_to_rescan.Num() > 0 )
+    {
+        asset_registry.ScanFilesSynchronous( file_names_to_rescan, true );
+    }
+
+    TArray< FAssetData > asset_data_list;
+    auto num_invalid_assets = 0;
+
+    for ( auto path_index = 0; path_index < paths.Num(); ++path_index )
+    {
+        const auto & path = paths[ path_index ];
+        const auto & package_name = package_names[ path_index ];
+
+        if ( package_name.IsEmpty() )
+        {
+            response += FString::Printf( TEXT( "Error\t%s\tThe path is not inside a content directory of the project\n" ), *path );
+            continue;
+        }
+
+        if ( !FPaths::FileExists( file_names[ path_index ] ) )
+        {
+            response += FString::Printf( TEXT( "Error\t%s\tThe package does not exist\n" ), *path );
+            continue;
+        }
+
+        asset_data_list.Reset();
+        asset_registry.GetAssetsByPackageName( *package_name, asset_data_list, true );
+
+        if ( asset_data_list.Num() == 0 )
+        {
+            // The file may have been created before the watcher notified it
+            asset_registry.ScanFilesSynchronous( { file_names[ path_index ] }, true );
+            asset_registry.GetAssetsByPackageName( *package_name, asset_data_list, true );
+        }
+
+        if ( asset_data_list.Num() == 0 )
+        {
+            response += FString::Printf( TEXT( "Error\t%s\tThe package does not contain any asset\n" ), *path );
+            continue;
+        }
+
+        for ( const auto & asset_data : asset_data_list )
+        {
+            FText error_message;
+            FName rule_name;
+            const auto result = naming_validator_subsystem->IsAssetNamedCorrectly( error_message, rule_name, asset_data, context );
+
+            if ( result == ENamingConventionValidationResult::Invalid )
+            {
+                ++num_invalid_assets;
+            }
+
+            response += FString::Printf( TEXT( "%s\t%s\t%s\t%s\n" ),
+                *result_enum->GetNameStringByValue( static_cast< int64 >( result ) ),
+                *asset_data.PackageName.ToString(),
+                *rule_name.ToString(),
+                *error_message.ToString() );
+        }
+    }
+
+    response += FString::Printf( TEXT( "END\t%d\n" ), num_invalid_assets );
+}
@@ -1,33 +1,70 @@
-#include "NamingConventionValidation/Public/NamingConventionValidationSettings.h"
-
-UNamingConventionValidationSettings::UNamingConventionValidationSettings()
-{
-    LogWarningWhenNoClassDescriptionForAsset = false;
-    AllowValidationInDevelopersFolder = false;
-    AllowValidationOnlyInGameFolder = true;
-    DoesValidateOnSave = true;
-    BlueprintsPrefix = "BP_";
-}
-
-bool UNamingConventionValidationSettings::IsPathExcludedFromValidation( const FString & path ) const
-{
-    if ( !path.StartsWith( "/Game/" ) && AllowValidationOnlyInGameFolder )
-    {
-        return true;
-    }
-
-    if ( path.StartsWith( "/Game/Developers/" ) && !AllowValidationInDevelopersFolder )
-    {
-        return true;
-    }
-
-    for ( const auto & excluded_path : ExcludedDirectories )
-    {
-        if ( path.StartsWith( excluded_path.Path ) )
-        {
-            return true;
-        }
-    }
-
-    return false;
+#include "NamingConventionValidation/Public/NamingConventionValidationSettings.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+
+#include <Editor.h>
+
+UNamingConventionValidationSettings::UNamingConventionValidationSettings()
+{
+    LogWarningWhenNoClassDescriptionForAsset = false;
+    AllowValidationInDevelopersFolder = false;
+    AllowValidationOnlyInGameFolder = true;
+    DoesValidateOnSave = true;
+    SaveValidatorTimeBudgetPerCall = 20.0f;
+    SaveValidatorTimeBudgetPerBatch = 100.0f;
+    SaveValidatorQuarantineDuration = 600.0f;
+    DoesValidateNameCollisions = false;
+    DoesValidateDuringCook = false;
+    DoesValidateWithDataValidation = false;
+    DoesValidateAffectedAssetsOnSettingsChange = true;
+    DoesShowResultsInPanel = true;
+    DoesListExcludedAssetsInResultsPanel = false;
+    AsyncValidationTimeBudgetPerFrame = 10.0f;
+    DoesValidateInBackground = false;
+    BackgroundValidationTimeBudgetPerFrame = 1.0f;
+    BackgroundValidationIdleDelay = 5.0f;
+    DoesValidateFolderNames = false;
+    BlueprintsPrefix = "BP_";
+}
+
+void UNamingConventionValidationSettings::PostReloadConfig( FProperty * property_that_was_loaded )
+{
+    Super::PostReloadConfig( property_that_was_loaded );
+
+#if WITH_EDITOR
+    // Let the listeners rebuild their rules the same way they do when the settings are edited from the project settings
+    FPropertyChangedEvent property_changed_event( property_that_was_loaded );
+    OnSettingChanged().Broadcast( this, property_changed_event );
+#endif
+}
+
+bool UNamingConventionValidationSettings::IsPathExcludedFromValidation( const FString & path ) const
+{
+    if ( GEditor != nullptr )
+    {
+        if ( const auto * naming_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() )
+        {
+            return naming_validator_subsystem->GetRuleSet()->IsPathExcludedFromValidation( path );
+        }
+    }
+
+    if ( !path.StartsWith( "/Game/" ) && AllowValidationOnlyInGameFolder )
+    {
+        return true;
+    }
+
+    if ( path.StartsWith( "/Game/Developers/" ) && !AllowValidationInDevelopersFolder )
+    {
+        return true;
+    }
+
+    for ( const auto & excluded_path : ExcludedDirectories )
+    {
+        if ( path.StartsWith( excluded_path.Path ) )
+        {
+            return true;
+        }
+    }
+
+    return false;
 }
\ No newline at end of file
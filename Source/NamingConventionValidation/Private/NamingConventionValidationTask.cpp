@@ -0,0 +1,68 @@
+#include "NamingConventionValidationTask.h"
+
+FNamingConventionValidationContext::FNamingConventionValidationContext( const FNamingConventionValidationRuleSetRef & rule_set ) :
+    RuleSet( rule_set )
+{
+    CanUseEditorValidators = true;
+    CanLoadAssets = true;
+    IsSavePath = false;
+}
+
+FNamingConventionValidationStatistics::FNamingConventionValidationStatistics() :
+    NumFilesChecked( 0 ),
+    NumValidFiles( 0 ),
+    NumInvalidFiles( 0 ),
+    NumFilesSkipped( 0 ),
+    NumFilesUnableToValidate( 0 ),
+    NumSuppressedFiles( 0 )
+{
+}
+
+void FNamingConventionValidationStatistics::AddResult( const ENamingConventionValidationResult result )
+{
+    switch ( result )
+    {
+        case ENamingConventionValidationResult::Excluded:
+        {
+            ++NumFilesSkipped;
+        }
+        break;
+        case ENamingConventionValidationResult::Valid:
+        {
+            ++NumValidFiles;
+            ++NumFilesChecked;
+        }
+        break;
+        case ENamingConventionValidationResult::Invalid:
+        {
+            ++NumInvalidFiles;
+            ++NumFilesChecked;
+        }
+        break;
+        case ENamingConventionValidationResult::Unknown:
+        {
+            ++NumFilesChecked;
+            ++NumFilesUnableToValidate;
+        }
+        break;
+    }
+}
+
+void FNamingConventionValidationStatistics::AddSuppressedResult()
+{
+    ++NumSuppressedFiles;
+    ++NumFilesChecked;
+}
+
+FNamingConventionValidationTask::FNamingConventionValidationTask( TArray< FAssetData > && asset_data_list, const FNamingConventionValidationContext & context ) :
+    AssetDataList( MoveTemp( asset_data_list ) ),
+    Context( context ),
+    Log( "NamingConventionValidation" ),
+    NumNewlyValidAssets( 0 ),
+    NumNewlyInvalidAssets( 0 ),
+    NextAssetIndex( 0 )
+{
+    IsCancelled = false;
+    LogExcludedAssets = false;
+    LogUnknownAssets = false;
+}
@@ -0,0 +1,52 @@
+#include "NamingConventionValidationVerdictCache.h"
+
+void FNamingConventionValidationVerdictCache::Record( const FName object_path, const FName package_name, const ENamingConventionValidationResult result, const FName rule_name, const uint32 rule_set_version )
+{
+    auto & verdict = Verdicts.FindOrAdd( object_path );
+
+    if ( verdict.PackageName.IsNone() || verdict.RuleName != rule_name )
+    {
+        if ( !verdict.PackageName.IsNone() )
+        {
+            if ( auto * object_paths = ObjectPathsPerRule.Find( verdict.RuleName ) )
+            {
+                object_paths->Remove( object_path );
+            }
+        }
+
+        ObjectPathsPerRule.FindOrAdd( rule_name ).Add( object_path );
+    }
+
+    verdict.PackageName = package_name;
+    verdict.RuleName = rule_name;
+    verdict.Result = result;
+    verdict.RuleSetVersion = rule_set_version;
+}
+
+bool FNamingConventionValidationVerdictCache::Remove( const FName object_path )
+{
+    FNamingConventionValidationVerdict verdict;
+
+    if ( !Verdicts.RemoveAndCopyValue( object_path, verdict ) )
+    {
+        return false;
+    }
+
+    if ( auto * object_paths = ObjectPathsPerRule.Find( verdict.RuleName ) )
+    {
+        object_paths->Remove( object_path );
+    }
+
+    return true;
+}
+
+void FNamingConventionValidationVerdictCache::Promote( const uint32 old_rule_set_version, const uint32 new_rule_set_version, const TSet< FName > & affected_object_paths )
+{
+    for ( auto & pair : Verdicts )
+    {
+        if ( pair.Value.RuleSetVersion == old_rule_set_version && !affected_object_paths.Contains( pair.Key ) )
+        {
+            pair.Value.RuleSetVersion = new_rule_set_version;
+        }
+    }
+}
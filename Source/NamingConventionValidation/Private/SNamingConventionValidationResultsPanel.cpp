@@ -0,0 +1,399 @@
+#include "SNamingConventionValidationResultsPanel.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+
+#include <AssetRegistryModule.h>
+#include <Editor.h>
+#include <EditorStyleSet.h>
+#include <Misc/PackageName.h>
+#include <Widgets/Input/SCheckBox.h>
+#include <Widgets/Text/STextBlock.h>
+#include <Widgets/Views/SExpanderArrow.h>
+#include <Widgets/Views/SHeaderRow.h>
+#include <Widgets/Views/STableRow.h>
+
+#define LOCTEXT_NAMESPACE "NamingConventionValidationResultsPanel"
+
+const FName SNamingConventionValidationResultsPanel::TabName( "NamingConventionValidationResults" );
+
+namespace NamingConventionValidationResultsColumns
+{
+    static const FName Name( "Name" );
+    static const FName Class( "Class" );
+    static const FName Rule( "Rule" );
+    static const FName Result( "Result" );
+    static const FName Message( "Message" );
+}
+
+FText GetValidationResultText( const ENamingConventionValidationResult result )
+{
+    switch ( result )
+    {
+        case ENamingConventionValidationResult::Invalid:
+        {
+            return LOCTEXT( "ResultInvalid", "Invalid" );
+        }
+        case ENamingConventionValidationResult::Excluded:
+        {
+            return LOCTEXT( "ResultExcluded", "Excluded" );
+        }
+        case ENamingConventionValidationResult::Unknown:
+        {
+            return LOCTEXT( "ResultUnknown", "Unknown" );
+        }
+        default:
+        {
+            return LOCTEXT( "ResultValid", "Valid" );
+        }
+    }
+}
+
+class SNamingConventionValidationResultsRow final : public SMultiColumnTableRow< FNamingConventionValidationResultsTreeItemPtr >
+{
+public:
+    SLATE_BEGIN_ARGS( SNamingConventionValidationResultsRow )
+    {}
+    SLATE_END_ARGS()
+
+    void Construct( const FArguments & /*args*/, const TSharedRef< STableViewBase > & owner_table, const FNamingConventionValidationResultsTreeItemPtr & item, const TSharedRef< const FNamingConventionValidationResults > & results )
+    {
+        Item = item;
+        Results = results;
+
+        FSuperRowType::Construct( FSuperRowType::FArguments(), owner_table );
+    }
+
+    TSharedRef< SWidget > GenerateWidgetForColumn( const FName & column_name ) override
+    {
+        if ( Item->IsGroup() )
+        {
+            if ( column_name == NamingConventionValidationResultsColumns::Name )
+            {
+                return CreateNameWidget( FText::Format( LOCTEXT( "GroupName", "{0} ({1})" ), FText::FromName( Item->GroupName ), Item->RecordIndices.Num() ) );
+            }
+
+            return SNullWidget::NullWidget;
+        }
+
+        const auto & record = Results->GetRecords()[ Item->RecordIndex ];
+
+        if ( column_name == NamingConventionValidationResultsColumns::Name )
+        {
+            return CreateNameWidget( FText::FromName( record.PackageName ) );
+        }
+
+        if ( column_name == NamingConventionValidationResultsColumns::Class )
+        {
+            return SNew( STextBlock ).Text( FText::FromName( record.AssetClass ) );
+        }
+
+        if ( column_name == NamingConventionValidationResultsColumns::Rule )
+        {
+            return SNew( STextBlock ).Text( FText::FromName( record.RuleName ) );
+        }
+
+        if ( column_name == NamingConventionValidationResultsColumns::Message )
+        {
+            return SNew( STextBlock )
+                .Text( record.Message )
+                .ToolTipText( record.Message );
+        }
+
+        return SNew( STextBlock )
+            .Text( GetValidationResultText( record.Result ) )
+            .ColorAndOpacity( record.Result == ENamingConventionValidationResult::Invalid ? FLinearColor::Red : FLinearColor::Yellow );
+    }
+
+private:
+    TSharedRef< SWidget > CreateNameWidget( const FText & text )
+    {
+        return SNew( SHorizontalBox )
+               + SHorizontalBox::Slot()
+                     .AutoWidth()
+                         [ SNew( SExpanderArrow, SharedThis( this ) ) ]
+               + SHorizontalBox::Slot()
+                     .FillWidth( 1.0f )
+                     .VAlign( VAlign_Center )
+                         [ SNew( STextBlock ).Text( text ) ];
+    }
+
+    FNamingConventionValidationResultsTreeItemPtr Item;
+    TSharedPtr< const FNamingConventionValidationResults > Results;
+};
+
+SNamingConventionValidationResultsPanel::~SNamingConventionValidationResultsPanel()
+{
+    if ( GEditor != nullptr )
+    {
+        if ( auto * naming_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() )
+        {
+            naming_validator_subsystem->OnResultsUpdated().Remove( OnResultsUpdatedDelegateHandle );
+        }
+    }
+}
+
+void SNamingConventionValidationResultsPanel::Construct( const FArguments & /*args*/ )
+{
+    Grouping = ENamingConventionValidationResultsGrouping::Folder;
+    NumInvalidAssets = 0;
+    NumUnknownAssets = 0;
+
+    ChildSlot
+        [ SNew( SVerticalBox )
+          + SVerticalBox::Slot()
+                .AutoHeight()
+                .Padding( 2.0f )
+                    [ SNew( SHorizontalBox )
+                      + SHorizontalBox::Slot()
+                            .AutoWidth()
+                            .VAlign( VAlign_Center )
+                            .Padding( 0.0f, 0.0f, 4.0f, 0.0f )
+                                [ SNew( STextBlock ).Text( LOCTEXT( "GroupBy", "Group by" ) ) ]
+                      + SHorizontalBox::Slot()
+                            .AutoWidth()
+                                [ CreateGroupingButton( ENamingConventionValidationResultsGrouping::Folder, LOCTEXT( "GroupByFolder", "Folder" ) ) ]
+                      + SHorizontalBox::Slot()
+                            .AutoWidth()
+                                [ CreateGroupingButton( ENamingConventionValidationResultsGrouping::Class, LOCTEXT( "GroupByClass", "Class" ) ) ]
+                      + SHorizontalBox::Slot()
+                            .AutoWidth()
+                                [ CreateGroupingButton( ENamingConventionValidationResultsGrouping::Rule, LOCTEXT( "GroupByRule", "Rule" ) ) ]
+                      + SHorizontalBox::Slot()
+                            .FillWidth( 1.0f )
+                            .HAlign( HAlign_Right )
+                            .VAlign( VAlign_Center )
+                                [ SNew( STextBlock )
+                                      .Text( this, &SNamingConventionValidationResultsPanel::GetSummaryText )
+                                      .ToolTipText( this, &SNamingConventionValidationResultsPanel::GetSummaryToolTipText ) ] ]
+          + SVerticalBox::Slot()
+                .FillHeight( 1.0f )
+                    [ SAssignNew( TreeView, STreeView< FNamingConventionValidationResultsTreeItemPtr > )
+                          .TreeItemsSource( &Groups )
+                          .SelectionMode( ESelectionMode::Multi )
+                          .OnGenerateRow( this, &SNamingConventionValidationResultsPanel::OnGenerateRow )
+                          .OnGetChildren( this, &SNamingConventionValidationResultsPanel::OnGetChildren )
+                          .OnMouseButtonDoubleClick( this, &SNamingConventionValidationResultsPanel::OnItemDoubleClicked )
+                          .HeaderRow(
+                              SNew( SHeaderRow )
+                              + SHeaderRow::Column( NamingConventionValidationResultsColumns::Name )
+                                    .DefaultLabel( LOCTEXT( "NameColumn", "Asset" ) )
+                                    .FillWidth( 0.35f )
+                              + SHeaderRow::Column( NamingConventionValidationResultsColumns::Class )
+                                    .DefaultLabel( LOCTEXT( "ClassColumn", "Class" ) )
+                                    .FillWidth( 0.15f )
+                              + SHeaderRow::Column( NamingConventionValidationResultsColumns::Rule )
+                                    .DefaultLabel( LOCTEXT( "RuleColumn", "Rule" ) )
+                                    .FillWidth( 0.15f )
+                              + SHeaderRow::Column( NamingConventionValidationResultsColumns::Result )
+                                    .DefaultLabel( LOCTEXT( "ResultColumn", "Result" ) )
+                                    .FillWidth( 0.1f )
+                              + SHeaderRow::Column( NamingConventionValidationResultsColumns::Message )
+                                    .DefaultLabel( LOCTEXT( "MessageColumn", "Message" ) )
+                                    .FillWidth( 0.25f ) ) ] ];
+
+    if ( GEditor != nullptr )
+    {
+        if ( auto * naming_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() )
+        {
+            OnResultsUpdatedDelegateHandle = naming_validator_subsystem->OnResultsUpdated().AddSP( this, &SNamingConventionValidationResultsPanel::OnResultsUpdated );
+        }
+    }
+
+    OnResultsUpdated();
+}
+
+void SNamingConventionValidationResultsPanel::OnResultsUpdated()
+{
+    Results = nullptr;
+
+    if ( GEditor != nullptr )
+    {
+        if ( const auto * naming_validator_subsystem = GEditor->GetEditorSubsystem< UEditorNamingValidatorSubsystem >() )
+        {
+            Results = naming_validator_subsystem->GetLatestResults();
+        }
+    }
+
+    RebuildTree();
+}
+
+void SNamingConventionValidationResultsPanel::RebuildTree()
+{
+    // The results of a running validation are refreshed periodically, so keep the groups which have been expanded
+    TSet< FName > expanded_group_names;
+
+    for ( const auto & group : Groups )
+    {
+        if ( TreeView->IsItemExpanded( group ) )
+        {
+            expanded_group_names.Add( group->GroupName );
+        }
+    }
+
+    TreeView->ClearExpandedItems();
+    Groups.Reset();
+    NumInvalidAssets = 0;
+    NumUnknownAssets = 0;
+
+    if ( Results.IsValid() )
+    {
+        TMap< FName, FNamingConventionValidationResultsTreeItemPtr > groups_by_name;
+        const auto & records = Results->GetRecords();
+
+        for ( auto record_index = 0; record_index < records.Num(); ++record_index )
+        {
+            const auto & record = records[ record_index ];
+            const auto group_name = GetGroupName( record );
+
+            auto & group = groups_by_name.FindOrAdd( group_name );
+            if ( !group.IsValid() )
+            {
+                group = MakeShared< FNamingConventionValidationResultsTreeItem >();
+                group->GroupName = group_name;
+                Groups.Add( group );
+            }
+
+            group->RecordIndices.Add( record_index );
+
+            NumInvalidAssets += record.Result == ENamingConventionValidationResult::Invalid ? 1 : 0;
+            NumUnknownAssets += record.Result == ENamingConventionValidationResult::Unknown ? 1 : 0;
+        }
+
+        Groups.Sort( []( const FNamingConventionValidationResultsTreeItemPtr & first, const FNamingConventionValidationResultsTreeItemPtr & second ) {
+            return first->GroupName.Compare( second->GroupName ) < 0;
+        } );
+
+        for ( const auto & group : Groups )
+        {
+            if ( expanded_group_names.Contains( group->GroupName ) )
+            {
+                TreeView->SetItemExpansion( group, true );
+            }
+        }
+    }
+
+    TreeView->RequestTreeRefresh();
+}
+
+void SNamingConventionValidationResultsPanel::SetGrouping( const ENamingConventionValidationResultsGrouping grouping )
+{
+    if ( Grouping != grouping )
+    {
+        Grouping = grouping;
+        RebuildTree();
+    }
+}
+
+FName SNamingConventionValidationResultsPanel::GetGroupName( const FNamingConventionValidationResultRecord & record ) const
+{
+    switch ( Grouping )
+    {
+        case ENamingConventionValidationResultsGrouping::Folder:
+        {
+            return FName( *FPackageName::GetLongPackagePath( record.PackageName.ToString() ) );
+        }
+        case ENamingConventionValidationResultsGrouping::Class:
+        {
+            return record.AssetClass;
+        }
+        default:
+        {
+            return record.RuleName;
+        }
+    }
+}
+
+FText SNamingConventionValidationResultsPanel::GetSummaryText() const
+{
+    if ( !Results.IsValid() )
+    {
+        return LOCTEXT( "NoResults", "No naming convention validation has been run yet." );
+    }
+
+    FFormatNamedArguments arguments;
+    arguments.Add( TEXT( "Title" ), Results->GetTitle() );
+    arguments.Add( TEXT( "NumInvalid" ), NumInvalidAssets );
+    arguments.Add( TEXT( "NumUnknown" ), NumUnknownAssets );
+    arguments.Add( TEXT( "NumExcluded" ), Results->GetNumExcludedAssets() );
+
+    return FText::Format( LOCTEXT( "Summary", "{Title}: {NumInvalid} invalid, {NumUnknown} unknown, {NumExcluded} excluded" ), arguments );
+}
+
+FText SNamingConventionValidationResultsPanel::GetSummaryToolTipText() const
+{
+    if ( !Results.IsValid() || Results->GetNumExcludedAssets() == 0 )
+    {
+        return FText::GetEmpty();
+    }
+
+    FString tool_tip = LOCTEXT( "ExcludedAssetsPerRule", "Excluded assets per rule:" ).ToString();
+
+    for ( const auto & pair : Results->GetNumExcludedAssetsPerRule() )
+    {
+        tool_tip += FString::Printf( TEXT( "\n%s: %d" ), *pair.Key.ToString(), pair.Value );
+    }
+
+    return FText::FromString( tool_tip );
+}
+
+TSharedRef< SWidget > SNamingConventionValidationResultsPanel::CreateGroupingButton( const ENamingConventionValidationResultsGrouping grouping, const FText & label )
+{
+    return SNew( SCheckBox )
+        .Style( FEditorStyle::Get(), "RadioButton" )
+        .Padding( FMargin( 4.0f, 0.0f, 8.0f, 0.0f ) )
+        .IsChecked_Lambda( [ this, grouping ]() {
+            return Grouping == grouping ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+        } )
+        .OnCheckStateChanged_Lambda( [ this, grouping ]( ECheckBoxState /*state*/ ) {
+            SetGrouping( grouping );
+        } )
+            [ SNew( STextBlock ).Text( label ) ];
+}
+
+TSharedRef< ITableRow > SNamingConventionValidationResultsPanel::OnGenerateRow( const FNamingConventionValidationResultsTreeItemPtr item, const TSharedRef< STableViewBase > & owner_table )
+{
+    return SNew( SNamingConventionValidationResultsRow, owner_table, item, Results.ToSharedRef() );
+}
+
+void SNamingConventionValidationResultsPanel::OnGetChildren( const FNamingConventionValidationResultsTreeItemPtr item, TArray< FNamingConventionValidationResultsTreeItemPtr > & children )
+{
+    if ( !item->IsGroup() )
+    {
+        return;
+    }
+
+    if ( item->Children.Num() == 0 )
+    {
+        item->Children.Reserve( item->RecordIndices.Num() );
+
+        for ( const auto record_index : item->RecordIndices )
+        {
+            auto child = MakeShared< FNamingConventionValidationResultsTreeItem >();
+            child->RecordIndex = record_index;
+            item->Children.Emplace( MoveTemp( child ) );
+        }
+    }
+
+    children = item->Children;
+}
+
+void SNamingConventionValidationResultsPanel::OnItemDoubleClicked( const FNamingConventionValidationResultsTreeItemPtr item )
+{
+    if ( item->IsGroup() )
+    {
+        TreeView->SetItemExpansion( item, !TreeView->IsItemExpanded( item ) );
+        return;
+    }
+
+    const auto & asset_registry = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) ).Get();
+
+    TArray< FAssetData > asset_data_list;
+    asset_registry.GetAssetsByPackageName( Results->GetRecords()[ item->RecordIndex ].PackageName, asset_data_list );
+
+    if ( asset_data_list.Num() > 0 )
+    {
+        GEditor->SyncBrowserToObjects( asset_data_list );
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -1,46 +1,200 @@
-#pragma once
-
-#include "NamingConventionValidationTypes.h"
-
-#include <CoreMinimal.h>
-#include <EditorSubsystem.h>
-
-#include "EditorNamingValidatorSubsystem.generated.h"
-
-class UEditorNamingValidatorBase;
-struct FAssetData;
-
-UCLASS( Config = Editor )
-class NAMINGCONVENTIONVALIDATION_API UEditorNamingValidatorSubsystem final : public UEditorSubsystem
-{
-    GENERATED_BODY()
-
-public:
-    UEditorNamingValidatorSubsystem();
-
-    void Initialize( FSubsystemCollectionBase & collection ) override;
-    void Deinitialize() override;
-
-    int32 ValidateAssets( const TArray< FAssetData > & asset_data_list, bool skip_excluded_directories = true, bool show_if_no_failures = true ) const;
-    void ValidateSavedPackage( FName package_name );
-    void AddValidator( UEditorNamingValidatorBase * validator );
-    ENamingConventionValidationResult IsAssetNamedCorrectly( FText & error_message, const FAssetData & asset_data, bool can_use_editor_validators = true ) const;
-
-private:
-    void RegisterBlueprintValidators();
-    void CleanupValidators();
-    void ValidateAllSavedPackages();
-    void ValidateOnSave( const TArray< FAssetData > & asset_data_list ) const;
-    ENamingConventionValidationResult DoesAssetMatchNameConvention( FText & error_message, const FAssetData & asset_data, FName asset_class, bool can_use_editor_validators = true ) const;
-    bool IsClassExcluded( FText & error_message, const UClass * asset_class ) const;
-    ENamingConventionValidationResult DoesAssetMatchesClassDescriptions( FText & error_message, const UClass * asset_class, const FString & asset_name ) const;
-    ENamingConventionValidationResult DoesAssetMatchesValidators( FText & error_message, const UClass * asset_class, const FAssetData & asset_data ) const;
-
-    UPROPERTY( config )
-    uint8 AllowBlueprintValidators : 1;
-
-    UPROPERTY( Transient )
-    TMap< UClass *, UEditorNamingValidatorBase * > Validators;
-
-    TArray< FName > SavedPackagesToValidate;
-};
+#pragma once
+
+#include "NamingConventionValidationResults.h"
+#include "NamingConventionValidationRuleSet.h"
+#include "NamingConventionValidationTask.h"
+#include "NamingConventionValidationTypes.h"
+#include "NamingConventionValidationVerdictCache.h"
+
+#include <CoreMinimal.h>
+#include <EditorSubsystem.h>
+
+#include "EditorNamingValidatorSubsystem.generated.h"
+
+class FNamingConventionValidationBaseline;
+class UEditorNamingValidatorBase;
+struct FAssetData;
+
+// Execution time of a validator, accumulated over all the validations
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidatorTimings
+{
+    FNamingConventionValidatorTimings() :
+        TotalSeconds( 0.0 ),
+        MaxSeconds( 0.0 ),
+        NumCalls( 0 ),
+        SaveBatchSeconds( 0.0 ),
+        SaveBatchFrame( 0 ),
+        QuarantineEndTime( 0.0 )
+    {}
+
+    bool IsQuarantined( const double current_time ) const
+    {
+        return current_time < QuarantineEndTime;
+    }
+
+    double TotalSeconds;
+    double MaxSeconds;
+    int32 NumCalls;
+
+    // Time spent during the validation of the assets saved together, which are all validated during the same frame
+    double SaveBatchSeconds;
+    uint64 SaveBatchFrame;
+    double QuarantineEndTime;
+};
+
+DECLARE_MULTICAST_DELEGATE( FOnNamingConventionValidationResultsUpdated );
+DECLARE_MULTICAST_DELEGATE( FOnNamingConventionValidationVerdictsUpdated );
+
+UCLASS( Config = Editor )
+class NAMINGCONVENTIONVALIDATION_API UEditorNamingValidatorSubsystem final : public UEditorSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UEditorNamingValidatorSubsystem();
+
+    void Initialize( FSubsystemCollectionBase & collection ) override;
+    void Deinitialize() override;
+
+    // Gathers the assets of the given folders and their sub-folders, without enumerating the external actors and objects folders
+    void GetAssetsToValidate( TArray< FAssetData > & asset_data_list, const TArray< FString > & package_paths ) const;
+
+    // When a baseline is given, all the violations are recorded in it, and the ones which are part of the baseline are not reported nor counted as failures
+    int32 ValidateAssets( const TArray< FAssetData > & asset_data_list, bool skip_excluded_directories = true, bool show_if_no_failures = true, FNamingConventionValidationBaseline * baseline = nullptr );
+
+    // Validates the assets over several frames, with a cancellable progress notification. Results are streamed into the message log
+    void ValidateAssetsAsync( TArray< FAssetData > && asset_data_list );
+    void ValidateSavedPackage( FName package_name );
+
+    // True when the package was saved during this frame or the previous one, which is when the saved packages are validated,
+    // by this subsystem and by the DataValidation plugin
+    bool WasPackageJustSaved( FName package_name ) const;
+    void AddValidator( UEditorNamingValidatorBase * validator );
+    ENamingConventionValidationResult IsAssetNamedCorrectly( FText & error_message, const FAssetData & asset_data, bool can_use_editor_validators = true ) const;
+
+    // rule_name is set to the name of the rule which decided the result, or NAME_None if the result is Unknown
+    ENamingConventionValidationResult IsAssetNamedCorrectly( FText & error_message, FName & rule_name, const FAssetData & asset_data, const FNamingConventionValidationContext & context ) const;
+
+    // Reports the groups of assets which share the same name, or whose names only differ by case, in different folders. Returns the number of groups
+    int32 ValidateAssetNameCollisions( const TArray< FAssetData > & asset_data_list, bool show_if_no_failures = true ) const;
+
+    // Logs the time spent by each validator since the editor started, and the validators quarantined from the save path
+    void LogValidatorTimings() const;
+
+    // Returns the most recent rule set. Callers should keep the returned reference for the whole duration of a validation
+    FNamingConventionValidationRuleSetRef GetRuleSet() const;
+
+    // Results of the last validation displayed in the results panel, or nullptr if there is none
+    TSharedPtr< const FNamingConventionValidationResults > GetLatestResults() const
+    {
+        return LatestResults;
+    }
+
+    FOnNamingConventionValidationResultsUpdated & OnResultsUpdated()
+    {
+        return ResultsUpdatedDelegate;
+    }
+
+    // Last result of each asset validated since the editor started
+    const FNamingConventionValidationVerdictCache & GetVerdictCache() const
+    {
+        return VerdictCache;
+    }
+
+    // Returns nullptr if the asset has no verdict, or if its verdict may have been changed by the rules published since it was found
+    const FNamingConventionValidationVerdict * FindCurrentVerdict( FName object_path ) const;
+
+    // Broadcast when the verdict cache changes, at most once per second while a validation runs,
+    // and when a new rule set makes the verdicts of the previous one out of date
+    FOnNamingConventionValidationVerdictsUpdated & OnVerdictsUpdated()
+    {
+        return VerdictsUpdatedDelegate;
+    }
+
+private:
+    void RegisterBlueprintValidators();
+    void CleanupValidators();
+    void ValidateAllSavedPackages();
+    void ValidateOnSave( const TArray< FAssetData > & asset_data_list );
+    int32 ValidateAssetsInContext( const TArray< FAssetData > & asset_data_list, bool show_if_no_failures, FNamingConventionValidationBaseline * baseline, const FNamingConventionValidationContext & context );
+    void OnSettingsChanged( UObject * settings, FPropertyChangedEvent & property_changed_event );
+    void RequestRuleSetRebuild();
+    void RebuildRuleSet();
+    // Keeps the version of the current rule set when no rule changed
+    void PublishRuleSet( const TSharedRef< FNamingConventionValidationRuleSet, ESPMode::ThreadSafe > & rule_set );
+    // Validates again the assets of the verdict cache whose result may be changed by the new rule set, and reports the assets whose result changed
+    void ValidateAffectedAssets( const TSet< FName > & object_paths );
+    void GetAffectedObjectPaths( const FNamingConventionValidationRuleSetChanges & changes, uint32 old_rule_set_version, TSet< FName > & affected_object_paths ) const;
+    void AddNotification( const TSharedRef< FNamingConventionValidationTask > & task, const FText & text ) const;
+    bool Tick( float delta_time );
+    void TickAsyncValidations();
+    void FinishAsyncValidation( FNamingConventionValidationTask & task );
+    // Returns nullptr when the results must go to the message log
+    TSharedPtr< FNamingConventionValidationResults > CreateResults( const FText & title ) const;
+    void PublishResults( const TSharedRef< FNamingConventionValidationResults > & results );
+    void TickBackgroundValidation();
+    void StartBackgroundValidation();
+    // Lists the assets of the pending folders until some are found or the time is over
+    void GatherBackgroundValidationAssets( double end_time );
+    void OnObjectSavedDuringCook( UObject * object );
+    void LogCookValidationSummary() const;
+    void OnAssetAdded( const FAssetData & asset_data );
+    void OnAssetRenamed( const FAssetData & asset_data, const FString & old_object_path );
+    void OnAssetRemoved( const FAssetData & asset_data );
+    void TickValidationTask( FNamingConventionValidationTask & task, double time_budget_seconds );
+    // Results found with a rule set which is not the latest one are not recorded
+    void RecordVerdict( const FAssetData & asset_data, ENamingConventionValidationResult result, FName rule_name, const FNamingConventionValidationContext & context );
+    void BroadcastVerdictsUpdated();
+    ENamingConventionValidationResult DoesAssetMatchNameConvention( FText & error_message, FName & rule_name, const FAssetData & asset_data, FName asset_class, const FNamingConventionValidationContext & context ) const;
+    ENamingConventionValidationResult DoesAssetMatchNameLint( FText & error_message, FName & rule_name, const FString & asset_name, const FNamingConventionValidationRuleSet & rule_set ) const;
+    ENamingConventionValidationResult DoesAssetMatchFolderRules( FText & error_message, FName & rule_name, const UClass * asset_class, const FAssetData & asset_data, const FNamingConventionValidationRuleSet & rule_set ) const;
+    // The folder rules are evaluated once per folder and rule set, then each asset of the folder only costs a lookup
+    const FNamingConventionValidationFolderVerdict & FindFolderVerdict( FName package_path, const FNamingConventionValidationRuleSet & rule_set ) const;
+    bool IsClassExcluded( FText & error_message, FName & rule_name, const UClass * asset_class, const FNamingConventionValidationRuleSet & rule_set ) const;
+    ENamingConventionValidationResult DoesAssetMatchesClassDescriptions( FText & error_message, FName & rule_name, const UClass * asset_class, const FString & asset_name, const FNamingConventionValidationRuleSet & rule_set ) const;
+    ENamingConventionValidationResult DoesAssetMatchesValidators( FText & error_message, FName & rule_name, const UClass * asset_class, const FAssetData & asset_data, const FNamingConventionValidationContext & context ) const;
+    void UpdateValidatorTimings( FName validator_name, double elapsed_seconds, const FNamingConventionValidationContext & context ) const;
+
+    UPROPERTY( config )
+    uint8 AllowBlueprintValidators : 1;
+
+    UPROPERTY( Transient )
+    TMap< UClass *, UEditorNamingValidatorBase * > Validators;
+
+    TArray< FName > SavedPackagesToValidate;
+
+    // Frame during which each package was last saved
+    TMap< FName, uint64 > SavedPackageFrames;
+
+    // Indexed by the class name of the validators
+    mutable TMap< FName, FNamingConventionValidatorTimings > ValidatorTimings;
+
+    FNamingConventionValidationRuleSetPtr RuleSet;
+    mutable FCriticalSection RuleSetCriticalSection;
+    uint32 LatestRuleSetVersion;
+    bool IsRuleSetRebuildPending;
+    FDelegateHandle OnSettingChangedDelegateHandle;
+
+    mutable TMap< FName, FNamingConventionValidationFolderVerdict > FolderVerdicts;
+    mutable uint32 FolderVerdictsRuleSetVersion;
+
+    TArray< TSharedRef< FNamingConventionValidationTask > > AsyncValidationTasks;
+    TUniquePtr< FNamingConventionValidationTask > BackgroundValidationTask;
+    TSet< FName > BackgroundValidationDirtyPackageNames;
+    TArray< FString > BackgroundValidationPendingPackagePaths;
+    uint32 BackgroundValidationRuleSetVersion;
+    FDelegateHandle TickerDelegateHandle;
+
+    FNamingConventionValidationStatistics CookValidationStatistics;
+    TSet< FName > CookValidatedObjectPaths;
+    FDelegateHandle OnObjectSavedDelegateHandle;
+
+    FNamingConventionValidationVerdictCache VerdictCache;
+    FOnNamingConventionValidationVerdictsUpdated VerdictsUpdatedDelegate;
+    double LastVerdictsBroadcastTime;
+    bool HasUnbroadcastVerdicts;
+
+    TSharedPtr< const FNamingConventionValidationResults > LatestResults;
+    double LastResultsBroadcastTime;
+    FOnNamingConventionValidationResultsUpdated ResultsUpdatedDelegate;
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <CoreMinimal.h>
+#include <EditorValidatorBase.h>
+
+#include "NamingConventionDataValidator.generated.h"
+
+/*
+ * Runs the naming convention validation on the assets processed by the DataValidation plugin,
+ * so a single enumeration of the project reports both kinds of errors.
+ */
+UCLASS()
+class NAMINGCONVENTIONVALIDATION_API UNamingConventionDataValidator final : public UEditorValidatorBase
+{
+    GENERATED_BODY()
+
+public:
+    bool IsEnabled() const override;
+    bool CanValidateAsset_Implementation( UObject * asset ) const override;
+    EDataValidationResult ValidateLoadedAsset_Implementation( UObject * asset, TArray< FText > & validation_errors ) override;
+};
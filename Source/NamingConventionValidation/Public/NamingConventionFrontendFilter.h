@@ -0,0 +1,43 @@
+#pragma once
+
+#include <ContentBrowserFrontEndFilterExtension.h>
+#include <CoreMinimal.h>
+#include <FrontendFilterBase.h>
+
+#include "NamingConventionFrontendFilter.generated.h"
+
+class UEditorNamingValidatorSubsystem;
+
+/*
+ * Only shows the assets whose last naming convention validation failed.
+ * The results come from the verdict cache of UEditorNamingValidatorSubsystem, so no asset is validated nor loaded by the filter:
+ * the assets which have not been validated since the editor started, or whose result the last change of rules may have changed, are not shown.
+ */
+class FNamingConventionFrontendFilter final : public FFrontendFilter
+{
+public:
+    explicit FNamingConventionFrontendFilter( TSharedPtr< FFrontendFilterCategory > category );
+    ~FNamingConventionFrontendFilter();
+
+    FString GetName() const override;
+    FText GetDisplayName() const override;
+    FText GetToolTipText() const override;
+    FLinearColor GetColor() const override;
+    void ActiveStateChanged( bool active ) override;
+    bool PassesFilter( FAssetFilterType item ) const override;
+
+private:
+    void OnVerdictsUpdated();
+
+    TWeakObjectPtr< UEditorNamingValidatorSubsystem > NamingValidatorSubsystem;
+    FDelegateHandle OnVerdictsUpdatedDelegateHandle;
+};
+
+UCLASS()
+class UNamingConventionContentBrowserFilterExtension final : public UContentBrowserFrontEndFilterExtension
+{
+    GENERATED_BODY()
+
+public:
+    void AddFrontEndFilterExtensions( TSharedPtr< FFrontendFilterCategory > default_category, TArray< TSharedRef< FFrontendFilter > > & filters ) const override;
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <CoreMinimal.h>
+
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationBaselineEntry
+{
+    FNamingConventionValidationBaselineEntry() = default;
+    FNamingConventionValidationBaselineEntry( const FName package_name, const FName rule_name ) :
+        PackageName( package_name ),
+        RuleName( rule_name )
+    {}
+
+    bool operator==( const FNamingConventionValidationBaselineEntry & other ) const
+    {
+        return PackageName == other.PackageName && RuleName == other.RuleName;
+    }
+
+    friend uint32 GetTypeHash( const FNamingConventionValidationBaselineEntry & entry )
+    {
+        return HashCombine( GetTypeHash( entry.PackageName ), GetTypeHash( entry.RuleName ) );
+    }
+
+    FName PackageName;
+    FName RuleName;
+};
+
+/*
+ * Known violations which must not fail a validation, so a project can fix its legacy violations progressively.
+ * The file is a text file, with one line per violation made of the package name and the rule name separated by a tab.
+ */
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationBaseline
+{
+public:
+    bool LoadFromFile( const FString & path );
+
+    // Writes all the violations recorded so far, whether they were in the loaded baseline or not
+    bool SaveViolationsToFile( const FString & path ) const;
+
+    // Returns true if the violation is part of the loaded baseline, and must be suppressed
+    bool RecordViolation( FName package_name, FName rule_name );
+
+    // Entries of the loaded baseline which have not been recorded as violations, because the assets have been fixed, renamed or deleted
+    void GetStaleEntries( TArray< FNamingConventionValidationBaselineEntry > & stale_entries ) const;
+
+    int32 GetNumEntries() const
+    {
+        return Entries.Num();
+    }
+
+private:
+    TSet< FNamingConventionValidationBaselineEntry > Entries;
+    TSet< FNamingConventionValidationBaselineEntry > Violations;
+};
@@ -1,21 +1,23 @@
-#pragma once
-
-#include <Commandlets/Commandlet.h>
-
-#include "NamingConventionValidationCommandlet.generated.h"
-
-UCLASS( CustomConstructor )
-class NAMINGCONVENTIONVALIDATION_API UNamingConventionValidationCommandlet : public UCommandlet
-{
-    GENERATED_BODY()
-
-public:
-
-    UNamingConventionValidationCommandlet();
-
-    // Begin UCommandlet Interface
-    int32 Main( const FString & params ) override;
-    // End UCommandlet Interface
-
-    static bool ValidateData();
-};
+#pragma once
+
+#include <Commandlets/Commandlet.h>
+
+#include "NamingConventionValidationCommandlet.generated.h"
+
+UCLASS( CustomConstructor )
+class NAMINGCONVENTIONVALIDATION_API UNamingConventionValidationCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+
+    UNamingConventionValidationCommandlet();
+
+    // Begin UCommandlet Interface
+    int32 Main( const FString & params ) override;
+    // End UCommandlet Interface
+
+    // When baseline_path is set, only the violations which are not part of the baseline make the validation fail.
+    // The name collisions only make the validation fail when does_fail_on_name_collisions is set, as the commandlet does
+    static bool ValidateData( bool check_name_collisions = false, const FString & baseline_path = FString(), const FString & write_baseline_path = FString(), bool does_fail_on_name_collisions = false );
+};
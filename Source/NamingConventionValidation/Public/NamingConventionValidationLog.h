@@ -1,5 +1,5 @@
-#pragma once
-
-#include <CoreMinimal.h>
-
+#pragma once
+
+#include <CoreMinimal.h>
+
 DECLARE_LOG_CATEGORY_EXTERN( LogNamingConventionValidation, Verbose, All )
\ No newline at end of file
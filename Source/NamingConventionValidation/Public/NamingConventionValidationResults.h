@@ -0,0 +1,56 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include <CoreMinimal.h>
+
+struct FAssetData;
+
+// Only names and the error message are stored, so a record stays small even when a validation reports tens of thousands of assets
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationResultRecord
+{
+    FName PackageName;
+    FName AssetClass;
+    FName RuleName;
+    FText Message;
+    ENamingConventionValidationResult Result;
+};
+
+/*
+ * Results of a validation displayed in the results panel instead of the message log.
+ * Valid assets are not recorded, and excluded assets are only counted per rule unless they are asked to be listed.
+ */
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationResults
+{
+public:
+    FNamingConventionValidationResults( const FText & title, bool list_excluded_assets );
+
+    void AddResult( const FAssetData & asset_data, ENamingConventionValidationResult result, FName rule_name, const FText & error_message );
+
+    const FText & GetTitle() const
+    {
+        return Title;
+    }
+
+    const TArray< FNamingConventionValidationResultRecord > & GetRecords() const
+    {
+        return Records;
+    }
+
+    const TMap< FName, int32 > & GetNumExcludedAssetsPerRule() const
+    {
+        return NumExcludedAssetsPerRule;
+    }
+
+    int32 GetNumExcludedAssets() const
+    {
+        return NumExcludedAssets;
+    }
+
+private:
+    FText Title;
+    TArray< FNamingConventionValidationResultRecord > Records;
+    TMap< FName, int32 > NumExcludedAssetsPerRule;
+    int32 NumExcludedAssets;
+    bool ListExcludedAssets;
+};
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Templates/SharedPointer.h>
+#include <UObject/WeakObjectPtrTemplates.h>
+
+class UNamingConventionValidationSettings;
+
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationCompiledClassDescription
+{
+    FNamingConventionValidationCompiledClassDescription() :
+        Priority( 0 )
+    {}
+
+    bool operator<( const FNamingConventionValidationCompiledClassDescription & other ) const
+    {
+        return Priority > other.Priority;
+    }
+
+    FString ClassPath;
+    FName RuleName;
+    TWeakObjectPtr< UClass > Class;
+    FString Prefix;
+    FString Suffix;
+    int32 Priority;
+};
+
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationCompiledFolderRule
+{
+    bool IsClassAllowed( const UClass * asset_class ) const;
+
+    FString PathPattern;
+    FName RuleName;
+    FString RequiredKeyword;
+    TArray< FString > AllowedClassPaths;
+    TArray< TWeakObjectPtr< UClass > > AllowedClasses;
+};
+
+enum class ENamingConventionValidationNameLintResult : uint8
+{
+    Valid,
+    ForbiddenCharacter,
+    NotPascalCase,
+    DoubleUnderscore,
+    TooLong
+};
+
+/*
+ * Checks the characters of a name in a single pass, using a lookup table of character classes built once per rule set.
+ */
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationCompiledNameLint
+{
+    enum ECharacterClass : uint8
+    {
+        Allowed = 1 << 0,
+        Uppercase = 1 << 1,
+        Lowercase = 1 << 2,
+        Digit = 1 << 3,
+        Underscore = 1 << 4
+    };
+
+    FNamingConventionValidationCompiledNameLint();
+
+    void Compile();
+
+    bool IsEnabled() const
+    {
+        return !AllowedCharacters.IsEmpty() || DoesRequirePascalCaseSegments || DoesForbidDoubleUnderscores || MaxLength > 0;
+    }
+
+    // error_index is set to the position of the first character which breaks the rule
+    ENamingConventionValidationNameLintResult Lint( const TCHAR * name, int32 length, int32 & error_index ) const;
+
+    FString AllowedCharacters;
+    int32 MaxLength;
+    uint8 DoesRequirePascalCaseSegments : 1;
+    uint8 DoesForbidDoubleUnderscores : 1;
+
+    // Only ASCII characters can be allowed, the other ones have no class
+    uint8 CharacterClasses[ 128 ];
+};
+
+// Differences between two versions of the rule set, used to find the assets whose result may have changed
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationRuleSetChanges
+{
+    FNamingConventionValidationRuleSetChanges() :
+        AreAllAssetsAffected( false )
+    {}
+
+    bool IsEmpty() const
+    {
+        return !AreAllAssetsAffected && ChangedRuleNames.Num() == 0 && ChangedPathPrefixes.Num() == 0 && ChangedPathPatterns.Num() == 0;
+    }
+
+    bool IsPackageAffected( const FString & package_name ) const;
+
+    // The assets whose result was decided by these rules
+    TSet< FName > ChangedRuleNames;
+
+    // The assets inside these folders, whatever rule decided their result
+    TArray< FString > ChangedPathPrefixes;
+
+    // The assets of the folders matching the patterns of the folder rules which have been added, removed or modified
+    TArray< FString > ChangedPathPatterns;
+
+    // Set when a rule checked for all the assets has changed
+    bool AreAllAssetsAffected;
+};
+
+/*
+ * Immutable snapshot of UNamingConventionValidationSettings, with classes resolved and descriptions sorted by priority.
+ * A new rule set with a higher version is built each time the settings change, and validations keep a reference
+ * to the rule set they started with.
+ */
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationRuleSet
+{
+    FNamingConventionValidationRuleSet();
+
+    // Must be called on the game thread, as it may load the classes referenced by the settings
+    static TSharedRef< FNamingConventionValidationRuleSet, ESPMode::ThreadSafe > CreateFromSettings( const UNamingConventionValidationSettings & settings, uint32 version );
+
+    // Does not touch any UObject, so it can be called from any thread
+    void Compile();
+
+    static void FindChanges( const FNamingConventionValidationRuleSet & old_rule_set, const FNamingConventionValidationRuleSet & new_rule_set, FNamingConventionValidationRuleSetChanges & changes );
+
+    // Packages of the actors and objects saved in their own file by levels using One File Per Actor
+    static bool IsExternalPackagePath( const FString & path );
+
+    bool IsPathExcludedFromValidation( const FString & path ) const;
+
+    // Returns the name of the rule which excludes the path, or NAME_None if the path is not excluded
+    FName FindPathExclusionRule( const FString & path ) const;
+    const UClass * FindExcludedClass( const UClass * asset_class, FName & rule_name ) const;
+    const FNamingConventionValidationCompiledClassDescription * FindClassDescription( const UClass * asset_class ) const;
+    void FindFolderRules( const FString & package_path, TArray< int32 > & folder_rule_indices ) const;
+
+    uint32 Version;
+    TArray< FString > ExcludedDirectories;
+    TArray< FName > ExcludedDirectoryRuleNames;
+    TArray< FString > ExcludedClassPaths;
+    TArray< TWeakObjectPtr< UClass > > ExcludedClasses;
+    TArray< FName > ExcludedClassRuleNames;
+    TArray< FNamingConventionValidationCompiledClassDescription > ClassDescriptions;
+    FNamingConventionValidationCompiledNameLint NameLint;
+    TArray< FNamingConventionValidationCompiledFolderRule > FolderRules;
+    FString BlueprintsPrefix;
+    uint8 LogWarningWhenNoClassDescriptionForAsset : 1;
+    uint8 AllowValidationInDevelopersFolder : 1;
+    uint8 AllowValidationOnlyInGameFolder : 1;
+    uint8 DoesValidateFolderNames : 1;
+
+private:
+    void InitializeRuleNames();
+    void ResolveClasses();
+};
+
+// What the rule set says about a folder, computed once per folder by UEditorNamingValidatorSubsystem
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationFolderVerdict
+{
+    // Set when the name of a folder of the path does not pass the name lint
+    FName FolderNameRuleName;
+    FText FolderNameErrorMessage;
+
+    // Indices of the folder rules of the rule set which apply to the folder
+    TArray< int32 > FolderRuleIndices;
+};
+
+typedef TSharedPtr< const FNamingConventionValidationRuleSet, ESPMode::ThreadSafe > FNamingConventionValidationRuleSetPtr;
+typedef TSharedRef< const FNamingConventionValidationRuleSet, ESPMode::ThreadSafe > FNamingConventionValidationRuleSetRef;
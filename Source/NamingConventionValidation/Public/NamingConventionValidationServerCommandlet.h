@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Commandlets/Commandlet.h>
+
+#include "NamingConventionValidationServerCommandlet.generated.h"
+
+class FSocket;
+struct FFileChangeData;
+
+/*
+ * Long running process which keeps the asset registry and the rule set in memory, so local tools like git hooks
+ * can validate a few files without paying for the editor initialization each time.
+ *
+ * Usage: -run=NamingConventionValidationServer [-Port=23950]
+ *
+ * The server only listens on 127.0.0.1. A request is a list of file paths or long package names, one per line, followed
+ * by an empty line. Relative file paths are relative to the project directory. The response contains one line per asset:
+ *     <Result>\t<PackageName>\t<RuleName>\t<Message>
+ * or Error\t<Path>\t<Message> for the paths which can not be validated, and ends with END\t<NumInvalidAssets>.
+ * A request made of the single line QUIT stops the server.
+ */
+UCLASS( CustomConstructor )
+class NAMINGCONVENTIONVALIDATION_API UNamingConventionValidationServerCommandlet final : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UNamingConventionValidationServerCommandlet();
+
+    // Begin UCommandlet Interface
+    int32 Main( const FString & params ) override;
+    // End UCommandlet Interface
+
+    static const int32 DefaultPort;
+
+private:
+    void OnContentDirectoryChanged( const TArray< FFileChangeData > & file_changes );
+    void RescanDirtyFiles( int32 max_num_files );
+    void HandleClient( FSocket & client_socket );
+    bool ReceiveRequest( FSocket & client_socket, TArray< FString > & lines ) const;
+    bool SendResponse( FSocket & client_socket, const FString & response ) const;
+    void ValidateFiles( const TArray< FString > & paths, FString & response );
+
+    // Files modified since they were last scanned by the asset registry
+    TSet< FString > DirtyFileNames;
+    bool IsStopRequested;
+};
@@ -1,76 +1,192 @@
-#pragma once
-
-#include <CoreMinimal.h>
-#include <Engine/DeveloperSettings.h>
-#include <Engine/EngineTypes.h>
-
-#include "NamingConventionValidationSettings.generated.h"
-
-USTRUCT()
-struct FNamingConventionValidationClassDescription
-{
-    GENERATED_USTRUCT_BODY()
-
-    FNamingConventionValidationClassDescription() :
-        Class( nullptr ),
-        Priority( 0 )
-    {}
-
-    bool operator<( const FNamingConventionValidationClassDescription & other ) const
-    {
-        return Priority > other.Priority;
-    }
-
-    UPROPERTY( config, EditAnywhere )
-    TSoftClassPtr< UObject > ClassPath;
-
-    UPROPERTY( transient )
-    UClass * Class;
-
-    UPROPERTY( config, EditAnywhere )
-    FString Prefix;
-
-    UPROPERTY( config, EditAnywhere )
-    FString Suffix;
-
-    UPROPERTY( config, EditAnywhere )
-    int Priority;
-};
-
-UCLASS( config = Editor )
-class NAMINGCONVENTIONVALIDATION_API UNamingConventionValidationSettings final : public UDeveloperSettings
-{
-    GENERATED_BODY()
-
-public:
-    UNamingConventionValidationSettings();
-
-    bool IsPathExcludedFromValidation( const FString & path ) const;
-
-    UPROPERTY( config, EditAnywhere, meta = ( LongPackageName, ConfigRestartRequired = true ) )
-    TArray< FDirectoryPath > ExcludedDirectories;
-
-    UPROPERTY( config, EditAnywhere )
-    uint8 LogWarningWhenNoClassDescriptionForAsset : 1;
-
-    UPROPERTY( config, EditAnywhere )
-    uint8 AllowValidationInDevelopersFolder : 1;
-
-    UPROPERTY( config, EditAnywhere )
-    uint8 AllowValidationOnlyInGameFolder : 1;
-
-    UPROPERTY( config, EditAnywhere )
-    bool DoesValidateOnSave;
-
-    UPROPERTY( config, EditAnywhere, meta = ( ConfigRestartRequired = true ) )
-    TArray< FNamingConventionValidationClassDescription > ClassDescriptions;
-
-    UPROPERTY( config, EditAnywhere )
-    TArray< TSoftClassPtr< UObject > > ExcludedClassPaths;
-
-    UPROPERTY( transient )
-    TArray< UClass * > ExcludedClasses;
-
-    UPROPERTY( config, EditAnywhere )
-    FString BlueprintsPrefix;
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Engine/DeveloperSettings.h>
+#include <Engine/EngineTypes.h>
+
+#include "NamingConventionValidationSettings.generated.h"
+
+USTRUCT()
+struct FNamingConventionValidationClassDescription
+{
+    GENERATED_USTRUCT_BODY()
+
+    FNamingConventionValidationClassDescription() :
+        Class( nullptr ),
+        Priority( 0 )
+    {}
+
+    bool operator<( const FNamingConventionValidationClassDescription & other ) const
+    {
+        return Priority > other.Priority;
+    }
+
+    UPROPERTY( config, EditAnywhere )
+    TSoftClassPtr< UObject > ClassPath;
+
+    // Set from the rule set published by UEditorNamingValidatorSubsystem, which is what the validation uses
+    UPROPERTY( transient )
+    UClass * Class;
+
+    UPROPERTY( config, EditAnywhere )
+    FString Prefix;
+
+    UPROPERTY( config, EditAnywhere )
+    FString Suffix;
+
+    UPROPERTY( config, EditAnywhere )
+    int Priority;
+};
+
+USTRUCT()
+struct FNamingConventionValidationNameLintRules
+{
+    GENERATED_USTRUCT_BODY()
+
+    FNamingConventionValidationNameLintRules() :
+        DoesRequirePascalCaseSegments( false ),
+        DoesForbidDoubleUnderscores( false ),
+        MaxLength( 0 )
+    {}
+
+    // Characters allowed in asset names, with support for ranges like A-Za-z0-9_. Put - at the end to allow it. Leave empty to allow all characters
+    UPROPERTY( config, EditAnywhere )
+    FString AllowedCharacters;
+
+    // Each part of the name delimited by underscores must start with an uppercase letter or a digit
+    UPROPERTY( config, EditAnywhere )
+    bool DoesRequirePascalCaseSegments;
+
+    UPROPERTY( config, EditAnywhere )
+    bool DoesForbidDoubleUnderscores;
+
+    // 0 means no limit
+    UPROPERTY( config, EditAnywhere, meta = ( ClampMin = "0" ) )
+    int32 MaxLength;
+};
+
+USTRUCT()
+struct FNamingConventionValidationFolderRule
+{
+    GENERATED_USTRUCT_BODY()
+
+    // Matched against the path of the folder of the assets, for example /Game/Characters/*/Animations. As * also matches /, /Game/Characters/* applies to all the sub-folders
+    UPROPERTY( config, EditAnywhere )
+    FString PathPattern;
+
+    // The names of the assets of the matching folders must contain this keyword. Leave empty to not check the names
+    UPROPERTY( config, EditAnywhere )
+    FString RequiredKeyword;
+
+    // Only the assets of these classes, or of their child classes, can be put in the matching folders. Leave empty to allow all classes
+    UPROPERTY( config, EditAnywhere )
+    TArray< TSoftClassPtr< UObject > > AllowedClasses;
+};
+
+UCLASS( config = Editor )
+class NAMINGCONVENTIONVALIDATION_API UNamingConventionValidationSettings final : public UDeveloperSettings
+{
+    GENERATED_BODY()
+
+public:
+    UNamingConventionValidationSettings();
+
+    void PostReloadConfig( FProperty * property_that_was_loaded ) override;
+
+    // Forwards to the rule set of UEditorNamingValidatorSubsystem. Prefer FNamingConventionValidationRuleSet::FindPathExclusionRule in new code
+    bool IsPathExcludedFromValidation( const FString & path ) const;
+
+    UPROPERTY( config, EditAnywhere, meta = ( LongPackageName ) )
+    TArray< FDirectoryPath > ExcludedDirectories;
+
+    UPROPERTY( config, EditAnywhere )
+    uint8 LogWarningWhenNoClassDescriptionForAsset : 1;
+
+    UPROPERTY( config, EditAnywhere )
+    uint8 AllowValidationInDevelopersFolder : 1;
+
+    UPROPERTY( config, EditAnywhere )
+    uint8 AllowValidationOnlyInGameFolder : 1;
+
+    UPROPERTY( config, EditAnywhere )
+    bool DoesValidateOnSave;
+
+    // A validator which takes longer than this to validate a single asset saved in the editor is quarantined: it is not used on save anymore,
+    // but keeps being used by the explicit validations. 0 means no limit
+    UPROPERTY( config, EditAnywhere, meta = ( EditCondition = "DoesValidateOnSave", ClampMin = "0.0", Units = "Milliseconds" ) )
+    float SaveValidatorTimeBudgetPerCall;
+
+    // Same as SaveValidatorTimeBudgetPerCall, for the total time spent by a validator on all the assets saved together
+    UPROPERTY( config, EditAnywhere, meta = ( EditCondition = "DoesValidateOnSave", ClampMin = "0.0", Units = "Milliseconds" ) )
+    float SaveValidatorTimeBudgetPerBatch;
+
+    // 0 keeps the validators quarantined until the editor is restarted
+    UPROPERTY( config, EditAnywhere, meta = ( EditCondition = "DoesValidateOnSave", ClampMin = "0.0", Units = "Seconds" ) )
+    float SaveValidatorQuarantineDuration;
+
+    // Also reports the assets of the project which share the same name, or whose names only differ by case, when validating the whole project
+    UPROPERTY( config, EditAnywhere )
+    bool DoesValidateNameCollisions;
+
+    // Reports the naming convention errors from the DataValidation plugin, when it validates assets
+    UPROPERTY( config, EditAnywhere )
+    bool DoesValidateWithDataValidation;
+
+    // Validates the assets saved by the cook commandlet, and logs a summary when the cook ends, so no separate pass over the project is needed
+    UPROPERTY( config, EditAnywhere )
+    bool DoesValidateDuringCook;
+
+    // Time spent each frame by the validations started from the content browser
+    UPROPERTY( config, EditAnywhere, meta = ( ClampMin = "1.0", Units = "Milliseconds" ) )
+    float AsyncValidationTimeBudgetPerFrame;
+
+    // When the settings change, validates again the assets validated since the editor started whose result may change,
+    // and reports the assets which are now valid or invalid
+    UPROPERTY( config, EditAnywhere )
+    bool DoesValidateAffectedAssetsOnSettingsChange;
+
+    // Displays the results of the validations started from the editor in a dedicated panel, grouped by folder, class or rule,
+    // instead of adding one message log entry per asset
+    UPROPERTY( config, EditAnywhere )
+    bool DoesShowResultsInPanel;
+
+    // When false, the excluded assets are only counted per exclusion rule
+    UPROPERTY( config, EditAnywhere, meta = ( EditCondition = "DoesShowResultsInPanel" ) )
+    bool DoesListExcludedAssetsInResultsPanel;
+
+    // Validates the project in small slices while the editor is idle, and reports the badly named assets in the message log
+    UPROPERTY( config, EditAnywhere )
+    bool DoesValidateInBackground;
+
+    UPROPERTY( config, EditAnywhere, meta = ( EditCondition = "DoesValidateInBackground", ClampMin = "0.1", Units = "Milliseconds" ) )
+    float BackgroundValidationTimeBudgetPerFrame;
+
+    // Number of seconds without any user interaction before the background validation resumes
+    UPROPERTY( config, EditAnywhere, meta = ( EditCondition = "DoesValidateInBackground", ClampMin = "0.0", Units = "Seconds" ) )
+    float BackgroundValidationIdleDelay;
+
+    UPROPERTY( config, EditAnywhere )
+    TArray< FNamingConventionValidationClassDescription > ClassDescriptions;
+
+    UPROPERTY( config, EditAnywhere )
+    TArray< TSoftClassPtr< UObject > > ExcludedClassPaths;
+
+    // Set from the rule set published by UEditorNamingValidatorSubsystem, which is what the validation uses
+    UPROPERTY( transient )
+    TArray< UClass * > ExcludedClasses;
+
+    // Checks applied to the names of all the assets which are not excluded, before the class descriptions and the validators
+    UPROPERTY( config, EditAnywhere )
+    FNamingConventionValidationNameLintRules NameLintRules;
+
+    // Also applies the name lint rules to the names of the folders of the assets, below the content root
+    UPROPERTY( config, EditAnywhere )
+    bool DoesValidateFolderNames;
+
+    // Rules applied to all the assets of the matching folders, before the validators and the class descriptions
+    UPROPERTY( config, EditAnywhere )
+    TArray< FNamingConventionValidationFolderRule > FolderRules;
+
+    UPROPERTY( config, EditAnywhere )
+    FString BlueprintsPrefix;
 };
\ No newline at end of file
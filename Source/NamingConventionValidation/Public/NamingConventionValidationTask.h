@@ -0,0 +1,90 @@
+#pragma once
+
+#include "NamingConventionValidationResults.h"
+#include "NamingConventionValidationRuleSet.h"
+#include "NamingConventionValidationTypes.h"
+
+#include <AssetData.h>
+#include <CoreMinimal.h>
+#include <Logging/MessageLog.h>
+
+class SNotificationItem;
+
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationContext
+{
+    explicit FNamingConventionValidationContext( const FNamingConventionValidationRuleSetRef & rule_set );
+
+    FNamingConventionValidationRuleSetRef RuleSet;
+    uint8 CanUseEditorValidators : 1;
+
+    // When false, assets whose class can not be found in the asset registry tags are reported as Unknown instead of being loaded
+    uint8 CanLoadAssets : 1;
+
+    // Set when validating the assets which have just been saved: the validators which are too slow are skipped
+    uint8 IsSavePath : 1;
+};
+
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationStatistics
+{
+    FNamingConventionValidationStatistics();
+
+    void AddResult( ENamingConventionValidationResult result );
+
+    // Invalid asset whose violation is part of a baseline
+    void AddSuppressedResult();
+
+    bool HasFailed() const
+    {
+        return NumInvalidFiles > 0;
+    }
+
+    int32 NumFilesChecked;
+    int32 NumValidFiles;
+    int32 NumInvalidFiles;
+    int32 NumFilesSkipped;
+    int32 NumFilesUnableToValidate;
+    int32 NumSuppressedFiles;
+};
+
+/*
+ * A validation which is spread over several frames by UEditorNamingValidatorSubsystem.
+ * Results are added to the naming convention message log as soon as they are produced.
+ */
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationTask
+{
+    FNamingConventionValidationTask( TArray< FAssetData > && asset_data_list, const FNamingConventionValidationContext & context );
+
+    bool IsFinished() const
+    {
+        return IsCancelled || NextAssetIndex >= AssetDataList.Num();
+    }
+
+    float GetProgress() const
+    {
+        return AssetDataList.Num() > 0 ? static_cast< float >( NextAssetIndex ) / AssetDataList.Num() : 1.0f;
+    }
+
+    void Cancel()
+    {
+        IsCancelled = true;
+    }
+
+    TArray< FAssetData > AssetDataList;
+    FNamingConventionValidationContext Context;
+    FNamingConventionValidationStatistics Statistics;
+    FMessageLog Log;
+
+    // When valid, the results of the assets are recorded here instead of being added to the log
+    TSharedPtr< FNamingConventionValidationResults > Results;
+
+    // When not empty, the results of the assets before a settings change, in the same order as AssetDataList.
+    // Only the assets whose result changed are added to the log
+    TArray< ENamingConventionValidationResult > PreviousResults;
+    int32 NumNewlyValidAssets;
+    int32 NumNewlyInvalidAssets;
+    TWeakPtr< SNotificationItem > Notification;
+    int32 NextAssetIndex;
+    uint8 IsCancelled : 1;
+    uint8 LogExcludedAssets : 1;
+    uint8 LogUnknownAssets : 1;
+};
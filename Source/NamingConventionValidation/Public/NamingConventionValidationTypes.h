@@ -1,12 +1,12 @@
-#pragma once
-
-#include "NamingConventionValidationTypes.generated.h"
-
-UENUM()
-enum class ENamingConventionValidationResult : uint8
-{
-    Invalid,
-    Valid,
-    Unknown,
-    Excluded
+#pragma once
+
+#include "NamingConventionValidationTypes.generated.h"
+
+UENUM()
+enum class ENamingConventionValidationResult : uint8
+{
+    Invalid,
+    Valid,
+    Unknown,
+    Excluded
 };
\ No newline at end of file
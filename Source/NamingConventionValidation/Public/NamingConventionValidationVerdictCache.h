@@ -0,0 +1,48 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include <CoreMinimal.h>
+
+struct FNamingConventionValidationVerdict
+{
+    FName PackageName;
+    FName RuleName;
+    ENamingConventionValidationResult Result;
+
+    // Version of the rule set which produced the result
+    uint32 RuleSetVersion;
+};
+
+/*
+ * Last result of each validated asset, indexed by object path, with a reverse index from the rules to the assets they decided.
+ */
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationVerdictCache
+{
+public:
+    void Record( FName object_path, FName package_name, ENamingConventionValidationResult result, FName rule_name, uint32 rule_set_version );
+    // Returns false if the asset had no verdict
+    bool Remove( FName object_path );
+    // Moves the verdicts of the old rule set to the new one, except the verdicts of the assets the change of rules may affect
+    void Promote( uint32 old_rule_set_version, uint32 new_rule_set_version, const TSet< FName > & affected_object_paths );
+
+    const FNamingConventionValidationVerdict * Find( const FName object_path ) const
+    {
+        return Verdicts.Find( object_path );
+    }
+
+    const TMap< FName, FNamingConventionValidationVerdict > & GetVerdicts() const
+    {
+        return Verdicts;
+    }
+
+    // Returns nullptr if the rule did not decide the result of any asset
+    const TSet< FName > * FindObjectPathsDecidedByRule( const FName rule_name ) const
+    {
+        return ObjectPathsPerRule.Find( rule_name );
+    }
+
+private:
+    TMap< FName, FNamingConventionValidationVerdict > Verdicts;
+    TMap< FName, TSet< FName > > ObjectPathsPerRule;
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "NamingConventionValidationResults.h"
+
+#include <CoreMinimal.h>
+#include <Widgets/SCompoundWidget.h>
+#include <Widgets/Views/STreeView.h>
+
+enum class ENamingConventionValidationResultsGrouping : uint8
+{
+    Folder,
+    Class,
+    Rule
+};
+
+struct FNamingConventionValidationResultsTreeItem
+{
+    FNamingConventionValidationResultsTreeItem() :
+        RecordIndex( INDEX_NONE )
+    {}
+
+    bool IsGroup() const
+    {
+        return RecordIndex == INDEX_NONE;
+    }
+
+    // Only used by the groups
+    FName GroupName;
+    TArray< int32 > RecordIndices;
+
+    // The items of the records are only created the first time the tree asks for the children of their group
+    TArray< TSharedPtr< FNamingConventionValidationResultsTreeItem > > Children;
+
+    int32 RecordIndex;
+};
+
+typedef TSharedPtr< FNamingConventionValidationResultsTreeItem > FNamingConventionValidationResultsTreeItemPtr;
+
+/*
+ * Displays the latest results of UEditorNamingValidatorSubsystem in a virtualized tree, grouped by folder, class or rule.
+ */
+class NAMINGCONVENTIONVALIDATION_API SNamingConventionValidationResultsPanel final : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS( SNamingConventionValidationResultsPanel )
+    {}
+    SLATE_END_ARGS()
+
+    static const FName TabName;
+
+    ~SNamingConventionValidationResultsPanel();
+
+    void Construct( const FArguments & args );
+
+private:
+    void OnResultsUpdated();
+    void RebuildTree();
+    void SetGrouping( ENamingConventionValidationResultsGrouping grouping );
+    FName GetGroupName( const FNamingConventionValidationResultRecord & record ) const;
+    FText GetSummaryText() const;
+    FText GetSummaryToolTipText() const;
+    TSharedRef< SWidget > CreateGroupingButton( ENamingConventionValidationResultsGrouping grouping, const FText & label );
+    TSharedRef< ITableRow > OnGenerateRow( FNamingConventionValidationResultsTreeItemPtr item, const TSharedRef< STableViewBase > & owner_table );
+    void OnGetChildren( FNamingConventionValidationResultsTreeItemPtr item, TArray< FNamingConventionValidationResultsTreeItemPtr > & children );
+    void OnItemDoubleClicked( FNamingConventionValidationResultsTreeItemPtr item );
+
+    TSharedPtr< const FNamingConventionValidationResults > Results;
+    TArray< FNamingConventionValidationResultsTreeItemPtr > Groups;
+    TSharedPtr< STreeView< FNamingConventionValidationResultsTreeItemPtr > > TreeView;
+    ENamingConventionValidationResultsGrouping Grouping;
+    int32 NumInvalidAssets;
+    int32 NumUnknownAssets;
+    FDelegateHandle OnResultsUpdatedDelegateHandle;
+};